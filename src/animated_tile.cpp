@@ -16,21 +16,113 @@
 #include "framerate_type.h"
 #include "date_func.h"
 #include "3rdparty/cpp-btree/btree_map.h"
+#include "3rdparty/cpp-btree/btree_set.h"
 
 #include "safeguards.h"
 
 /** The table/list with animated tiles. */
 btree::btree_map<TileIndex, AnimatedTileInfo> _animated_tiles;
 
+/**
+ * Number of speed buckets. A tile with speed s is animated when the tick counter
+ * is a multiple of 2^s, so speed 32 is only due when the counter wraps to 0 and
+ * higher speeds are never due.
+ */
+static const uint ANIMATED_TILE_SPEED_BUCKETS = 33;
+
+/** The animated tiles of one speed, grouped by tile type and ordered by tile index within each group. */
+struct AnimatedTileBucket {
+	btree::btree_set<TileIndex> tiles[ATG_END];
+};
+
+static AnimatedTileBucket _animated_tile_buckets[ANIMATED_TILE_SPEED_BUCKETS];
+static bool _animated_tile_buckets_valid = false;         ///< Whether the buckets match _animated_tiles, they are rebuilt lazily after loading.
+static bool _animating_tiles = false;                     ///< Whether the buckets are currently being iterated by AnimateAnimatedTiles.
+static btree::btree_set<TileIndex> _animated_tiles_deleted_in_pass;  ///< Tiles deleted while animating, to be skipped and removed at the end of the pass.
+static std::vector<TileIndex> _animated_tiles_relink_after_pass;     ///< Tiles which have to be moved to another bucket at the end of the pass.
+
+static AnimatedTileGroup GetAnimatedTileGroup(TileIndex tile)
+{
+	switch (GetTileType(tile)) {
+		case MP_HOUSE:    return ATG_HOUSE;
+		case MP_STATION:  return ATG_STATION;
+		case MP_INDUSTRY: return ATG_INDUSTRY;
+		case MP_OBJECT:   return ATG_OBJECT;
+		default:          return ATG_NONE;
+	}
+}
+
+/**
+ * Remove an animated tile from the speed bucket it is stored in, if any.
+ * @param tile the tile
+ * @param info the animated tile info of the tile
+ */
+static void UnlinkAnimatedTile(TileIndex tile, AnimatedTileInfo &info)
+{
+	if (info.bucket_group != ATG_NONE) {
+		_animated_tile_buckets[info.bucket_speed].tiles[info.bucket_group].erase(tile);
+		info.bucket_group = ATG_NONE;
+	}
+}
+
+/**
+ * Move an animated tile to the speed bucket matching its current speed and tile type.
+ * @param tile the tile
+ * @param info the animated tile info of the tile
+ */
+static void RelinkAnimatedTile(TileIndex tile, AnimatedTileInfo &info)
+{
+	AnimatedTileGroup group = info.speed < ANIMATED_TILE_SPEED_BUCKETS ? GetAnimatedTileGroup(tile) : ATG_NONE;
+	if (group == info.bucket_group && (group == ATG_NONE || info.speed == info.bucket_speed)) return;
+
+	UnlinkAnimatedTile(tile, info);
+	if (group != ATG_NONE) {
+		_animated_tile_buckets[info.speed].tiles[group].insert(tile);
+		info.bucket_speed = info.speed;
+		info.bucket_group = group;
+	}
+}
+
+/**
+ * Rebuild the speed buckets from _animated_tiles, if they are not up to date.
+ */
+static void EnsureAnimatedTileBuckets()
+{
+	if (_animated_tile_buckets_valid) return;
+
+	for (AnimatedTileBucket &bucket : _animated_tile_buckets) {
+		for (auto &tiles : bucket.tiles) tiles.clear();
+	}
+	for (auto iter = _animated_tiles.begin(); iter != _animated_tiles.end();) {
+		if (iter->second.pending_deletion) {
+			iter = _animated_tiles.erase(iter);
+			continue;
+		}
+		iter->second.bucket_group = ATG_NONE;
+		RelinkAnimatedTile(iter->first, iter->second);
+		++iter;
+	}
+	_animated_tile_buckets_valid = true;
+}
+
 /**
  * Removes the given tile from the animated tile table.
  * @param tile the tile to remove
  */
 void DeleteAnimatedTile(TileIndex tile)
 {
+	EnsureAnimatedTileBuckets();
+
 	auto to_remove = _animated_tiles.find(tile);
 	if (to_remove != _animated_tiles.end() && !to_remove->second.pending_deletion) {
-		to_remove->second.pending_deletion = true;
+		if (_animating_tiles) {
+			/* The buckets may not be modified while they are iterated. */
+			to_remove->second.pending_deletion = true;
+			_animated_tiles_deleted_in_pass.insert(tile);
+		} else {
+			UnlinkAnimatedTile(tile, to_remove->second);
+			_animated_tiles.erase(to_remove);
+		}
 		MarkTileDirtyByTile(tile, VMDF_NOT_MAP_MODE);
 	}
 }
@@ -72,10 +164,20 @@ static void UpdateAnimatedTileSpeed(TileIndex tile, AnimatedTileInfo &info)
  */
 void AddAnimatedTile(TileIndex tile)
 {
+	EnsureAnimatedTileBuckets();
+
 	MarkTileDirtyByTile(tile, VMDF_NOT_MAP_MODE);
 	AnimatedTileInfo &info = _animated_tiles[tile];
 	UpdateAnimatedTileSpeed(tile, info);
-	info.pending_deletion = false;
+	if (info.pending_deletion) {
+		info.pending_deletion = false;
+		_animated_tiles_deleted_in_pass.erase(tile);
+	}
+	if (_animating_tiles) {
+		_animated_tiles_relink_after_pass.push_back(tile);
+	} else {
+		RelinkAnimatedTile(tile, info);
+	}
 }
 
 int GetAnimatedTileSpeed(TileIndex tile)
@@ -87,8 +189,24 @@ int GetAnimatedTileSpeed(TileIndex tile)
 	return -1;
 }
 
+/**
+ * Call the animation proc of all tiles in an animated tile set.
+ * @param tiles the tiles to animate
+ * @param type the tile type of the tiles
+ * @param proc the animation proc for the type of the tiles
+ */
+static void AnimateAnimatedTileSet(const btree::btree_set<TileIndex> &tiles, TileType type, void (*proc)(TileIndex))
+{
+	for (TileIndex tile : tiles) {
+		if (!_animated_tiles_deleted_in_pass.empty() && _animated_tiles_deleted_in_pass.count(tile) != 0) continue;
+		assert_tile(GetTileType(tile) == type, tile);
+		proc(tile);
+	}
+}
+
 /**
  * Animate all tiles in the animated tile list, i.e.\ call AnimateTile on them.
+ * Only the speed buckets which are due in this tick are visited.
  */
 void AnimateAnimatedTiles()
 {
@@ -99,41 +217,35 @@ void AnimateAnimatedTiles()
 
 	PerformanceAccumulator framerate(PFE_GL_LANDSCAPE);
 
+	EnsureAnimatedTileBuckets();
+
 	const uint32 ticks = (uint) _scaled_tick_counter;
 	const uint8 max_speed = (ticks == 0) ? 32 : FindFirstBit(ticks);
 
-	auto iter = _animated_tiles.begin();
-	while (iter != _animated_tiles.end()) {
-		if (iter->second.pending_deletion) {
-			iter = _animated_tiles.erase(iter);
-			continue;
-		}
-
-		if (iter->second.speed <= max_speed) {
-			const TileIndex curr = iter->first;
-			switch (GetTileType(curr)) {
-				case MP_HOUSE:
-					AnimateTile_Town(curr);
-					break;
-
-				case MP_STATION:
-					AnimateTile_Station(curr);
-					break;
-
-				case MP_INDUSTRY:
-					AnimateTile_Industry(curr);
-					break;
-
-				case MP_OBJECT:
-					AnimateTile_Object(curr);
-					break;
+	_animating_tiles = true;
+	for (uint speed = 0; speed <= max_speed; speed++) {
+		const AnimatedTileBucket &bucket = _animated_tile_buckets[speed];
+		AnimateAnimatedTileSet(bucket.tiles[ATG_HOUSE], MP_HOUSE, AnimateTile_Town);
+		AnimateAnimatedTileSet(bucket.tiles[ATG_STATION], MP_STATION, AnimateTile_Station);
+		AnimateAnimatedTileSet(bucket.tiles[ATG_INDUSTRY], MP_INDUSTRY, AnimateTile_Industry);
+		AnimateAnimatedTileSet(bucket.tiles[ATG_OBJECT], MP_OBJECT, AnimateTile_Object);
+	}
+	_animating_tiles = false;
 
-				default:
-					NOT_REACHED();
-			}
+	for (TileIndex tile : _animated_tiles_deleted_in_pass) {
+		auto iter = _animated_tiles.find(tile);
+		if (iter != _animated_tiles.end() && iter->second.pending_deletion) {
+			UnlinkAnimatedTile(tile, iter->second);
+			_animated_tiles.erase(iter);
 		}
-		++iter;
 	}
+	_animated_tiles_deleted_in_pass.clear();
+
+	for (TileIndex tile : _animated_tiles_relink_after_pass) {
+		auto iter = _animated_tiles.find(tile);
+		if (iter != _animated_tiles.end()) RelinkAnimatedTile(tile, iter->second);
+	}
+	_animated_tiles_relink_after_pass.clear();
 }
 
 void UpdateAllAnimatedTileSpeeds()
@@ -147,6 +259,7 @@ void UpdateAllAnimatedTileSpeeds()
 		UpdateAnimatedTileSpeed(iter->first, iter->second);
 		++iter;
 	}
+	_animated_tile_buckets_valid = false;
 }
 
 /**
@@ -155,4 +268,7 @@ void UpdateAllAnimatedTileSpeeds()
 void InitializeAnimatedTiles()
 {
 	_animated_tiles.clear();
+	_animated_tiles_deleted_in_pass.clear();
+	_animated_tiles_relink_after_pass.clear();
+	_animated_tile_buckets_valid = false;
 }
@@ -13,9 +13,21 @@
 #include "tile_type.h"
 #include "3rdparty/cpp-btree/btree_map.h"
 
+/** Group of the animated tiles of one speed, by tile type. */
+enum AnimatedTileGroup : uint8 {
+	ATG_HOUSE,          ///< Town houses.
+	ATG_STATION,        ///< Station tiles.
+	ATG_INDUSTRY,       ///< Industry tiles.
+	ATG_OBJECT,         ///< Object tiles.
+	ATG_END,
+	ATG_NONE = ATG_END, ///< Not stored in any speed bucket.
+};
+
 struct AnimatedTileInfo {
 	uint8 speed = 0;
 	bool pending_deletion = false;
+	uint8 bucket_speed = 0;                    ///< Speed bucket the tile is currently stored in.
+	AnimatedTileGroup bucket_group = ATG_NONE; ///< Group within the speed bucket the tile is currently stored in.
 };
 
 extern btree::btree_map<TileIndex, AnimatedTileInfo> _animated_tiles;
@@ -187,55 +187,6 @@ bool CargoShift::operator()(CargoPacket *cp)
 	return cp_new == cp;
 }
 
-/**
- * Reroutes some cargo from one Station sublist to another.
- * @param cp Packet to be rerouted.
- * @return True if the packet was completely rerouted, false if part of it was.
- */
-bool StationCargoReroute::operator()(CargoPacket *cp)
-{
-	CargoPacket *cp_new = this->Preprocess(cp);
-	if (cp_new == nullptr) cp_new = cp;
-	StationID next = this->ge->GetVia(cp_new->SourceStation(), this->avoid, this->avoid2);
-	assert(next != this->avoid && next != this->avoid2);
-	if (this->source != this->destination) {
-		this->source->RemoveFromCache(cp_new, cp_new->Count());
-		this->destination->AddToCache(cp_new);
-	}
-
-	/* Legal, as insert doesn't invalidate iterators in the MultiMap, however
-	 * this might insert the packet between range.first and range.second (which might be end())
-	 * This is why we check for GetKey above to avoid infinite loops. */
-	this->destination->packets.Insert(next, cp_new);
-	return cp_new == cp;
-}
-
-/**
- * Reroutes some cargo in a VehicleCargoList.
- * @param cp Packet to be rerouted.
- * @param front_insert Front insert list.
- * @return True if the packet was completely rerouted, false if part of it was.
- */
-bool VehicleCargoReroute::operator()(CargoPacket *cp, std::vector<CargoPacket *> &front_insert)
-{
-	CargoPacket *cp_new = this->Preprocess(cp);
-	if (cp_new == nullptr) cp_new = cp;
-	if (cp_new->NextStation() == this->avoid || cp_new->NextStation() == this->avoid2) {
-		cp->SetNextStation(this->ge->GetVia(cp_new->SourceStation(), this->avoid, this->avoid2));
-	}
-	if (unlikely(this->source != this->destination)) {
-		this->source->RemoveFromMeta(cp_new, VehicleCargoList::MTA_TRANSFER, cp_new->Count());
-		this->destination->AddToMeta(cp_new, VehicleCargoList::MTA_TRANSFER);
-	}
-
-	if (likely(this->source == this->destination)) {
-		front_insert.push_back(cp_new);
-	} else {
-		this->destination->packets.push_front(cp_new);
-	}
-	return cp_new == cp;
-}
-
 template uint CargoRemoval<VehicleCargoList>::Preprocess(CargoPacket *cp);
 template uint CargoRemoval<StationCargoList>::Preprocess(CargoPacket *cp);
 template bool CargoRemoval<VehicleCargoList>::Postprocess(CargoPacket *cp, uint remove);
@@ -452,40 +452,6 @@ void VehicleCargoList::ShiftCargo(Taction action)
 	}
 }
 
-/**
- * Shifts cargo from the front of the packet list and applies some action to it.
- * @tparam Taction Action class or function to be used. It should define
- *                 "bool operator()(CargoPacket *, std::vector<CargoPacket*> &)". If true is returned the
- *                 cargo packet will be removed from the list. Otherwise it
- *                 will be kept and the loop will be aborted.
- *                 The second method parameter can be appended to, to prepend items to the packet list
- * @param action Action instance to be applied.
- * @param filter Cargo packet filter.
- */
-template<class Taction, class Tfilter>
-void VehicleCargoList::ShiftCargoWithFrontInsert(Taction action, Tfilter filter)
-{
-	std::vector<CargoPacket *> packets_to_front_insert;
-
-	Iterator it(this->packets.begin());
-	while (it != this->packets.end() && action.MaxMove() > 0) {
-		CargoPacket *cp = *it;
-		if (!filter(cp)) {
-			++it;
-			continue;
-		}
-		if (action(cp, packets_to_front_insert)) {
-			it = this->packets.erase(it);
-		} else {
-			break;
-		}
-	}
-
-	for (CargoPacket *cp : packets_to_front_insert) {
-		this->packets.push_front(cp);
-	}
-}
-
 /**
  * Pops cargo from the back of the packet list and applies some action to it.
  * @tparam Taction Action class or function to be used. It should define
@@ -639,6 +605,22 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, StationID
 	CargoPacketList transfer_deliver;
 	std::vector<CargoPacket *> keep;
 
+	/* Packets from the same source are often next to each other, so keep the last flow lookup. */
+	FlowStatMap::const_iterator flow_it = ge->flows.end();
+	StationID flow_source = INVALID_STATION;
+	bool flow_valid = false;
+	auto find_flow = [&](StationID source) -> FlowStatMap::const_iterator {
+		if (!flow_valid || source != flow_source) {
+			flow_it = ge->flows.find(source);
+			flow_source = source;
+			flow_valid = true;
+		}
+		return flow_it;
+	};
+
+	/* Flows excluding the current and next stations, by source, for forced transfers. */
+	btree::btree_map<StationID, FlowStat> transfer_shares;
+
 	bool force_keep = (order_flags & OUFB_NO_UNLOAD) != 0;
 	bool force_unload = (order_flags & OUFB_UNLOAD) != 0;
 	bool force_transfer = (order_flags & (OUFB_TRANSFER | OUFB_UNLOAD)) != 0;
@@ -657,16 +639,21 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, StationID
 			action = MTA_TRANSFER;
 			/* We cannot send the cargo to any of the possible next hops and
 			 * also not to the current station. */
-			FlowStatMap::const_iterator flow_it(ge->flows.find(cp->source));
-			if (flow_it == ge->flows.end()) {
+			FlowStatMap::const_iterator source_flow = find_flow(cp->source);
+			if (source_flow == ge->flows.end()) {
 				cargo_next = INVALID_STATION;
 			} else {
-				FlowStat new_shares = *flow_it;
-				new_shares.ChangeShare(current_station, INT_MIN);
-				StationIDStack excluded = next_station;
-				while (!excluded.IsEmpty() && !new_shares.empty()) {
-					new_shares.ChangeShare(excluded.Pop(), INT_MIN);
+				auto shares_it = transfer_shares.find(cp->source);
+				if (shares_it == transfer_shares.end()) {
+					FlowStat new_shares = *source_flow;
+					new_shares.ChangeShare(current_station, INT_MIN);
+					StationIDStack excluded = next_station;
+					while (!excluded.IsEmpty() && !new_shares.empty()) {
+						new_shares.ChangeShare(excluded.Pop(), INT_MIN);
+					}
+					shares_it = transfer_shares.insert(std::make_pair(cp->source, std::move(new_shares))).first;
 				}
+				const FlowStat &new_shares = shares_it->second;
 				if (new_shares.empty()) {
 					cargo_next = INVALID_STATION;
 				} else {
@@ -680,17 +667,17 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, StationID
 				cp->source = ge->flows.FirstStationID();
 			}
 			bool restricted = false;
-			FlowStatMap::const_iterator flow_it(ge->flows.find(cp->source));
-			if (flow_it == ge->flows.end()) {
+			FlowStatMap::const_iterator source_flow = find_flow(cp->source);
+			if (source_flow == ge->flows.end()) {
 				cargo_next = INVALID_STATION;
 			} else {
-				cargo_next = flow_it->GetViaWithRestricted(restricted);
+				cargo_next = source_flow->GetViaWithRestricted(restricted);
 			}
 			action = VehicleCargoList::ChooseAction(cp, cargo_next, current_station, accepted, next_station);
 			if (restricted && action == MTA_TRANSFER) {
 				/* If the flow is restricted we can't transfer to it. Choose an
 				 * unrestricted one instead. */
-				cargo_next = flow_it->GetVia();
+				cargo_next = source_flow->GetVia();
 				action = VehicleCargoList::ChooseAction(cp, cargo_next, current_station, accepted, next_station);
 			}
 		}
@@ -853,34 +840,103 @@ uint VehicleCargoList::Truncate(uint max_move)
 }
 
 /**
- * Routes packets with station "avoid" as next hop to a different place.
- * @param max_move Maximum amount of cargo to move.
- * @param dest List to prepend the cargo to.
- * @param avoid Station to exclude from routing and current next hop of packets to reroute.
+ * Chooses new next hops for rerouted cargo, excluding any number of stations.
+ * Flow lookups are kept across consecutive packets from the same source.
+ */
+class RerouteNextHopChooser {
+	const GoodsEntry *ge;                  ///< GoodsEntry to get the routing info from.
+	span<const StationID> avoid;           ///< Stations to exclude from routing.
+	StationID avoid2;                      ///< Additional station to exclude from routing.
+	FlowStatMap::const_iterator flow_it;   ///< Flow of the last looked up source, for a single excluded station.
+	StationID flow_source = INVALID_STATION; ///< Last looked up source.
+	bool flow_valid = false;               ///< If flow_it and flow_source are valid.
+	btree::btree_map<StationID, FlowStat> filtered; ///< Flows by source with all excluded stations removed, for more than one excluded station.
+
+public:
+	RerouteNextHopChooser(const GoodsEntry *ge, span<const StationID> avoid, StationID avoid2) :
+			ge(ge), avoid(avoid), avoid2(avoid2), flow_it(ge->flows.end()) {}
+
+	/**
+	 * Choose a new next hop for cargo from the given source.
+	 * @param source Source station of the cargo.
+	 * @return The chosen next hop, which is none of the excluded stations, or INVALID_STATION if none was found.
+	 */
+	StationID GetVia(StationID source)
+	{
+		if (this->avoid.size() <= 1) {
+			if (!this->flow_valid || source != this->flow_source) {
+				this->flow_it = this->ge->flows.find(source);
+				this->flow_source = source;
+				this->flow_valid = true;
+			}
+			if (this->flow_it == this->ge->flows.end()) return INVALID_STATION;
+			return this->flow_it->GetVia(this->avoid.empty() ? INVALID_STATION : *this->avoid.begin(), this->avoid2);
+		}
+
+		/* FlowStat::GetVia can only exclude two stations, so remove all of them from a copy of the flow instead. */
+		auto it = this->filtered.find(source);
+		if (it == this->filtered.end()) {
+			FlowStatMap::const_iterator source_flow = this->ge->flows.find(source);
+			if (source_flow == this->ge->flows.end()) return INVALID_STATION;
+			FlowStat shares = *source_flow;
+			for (StationID via : this->avoid) {
+				if (shares.empty()) break;
+				shares.ChangeShare(via, INT_MIN);
+			}
+			if (!shares.empty()) shares.ChangeShare(this->avoid2, INT_MIN);
+			it = this->filtered.insert(std::make_pair(source, std::move(shares))).first;
+		}
+		return it->second.empty() ? INVALID_STATION : it->second.GetVia();
+	}
+};
+
+/**
+ * Reroutes all cargo staged to be transferred whose next hop is one of the given stations or avoid2, in place.
+ * Only the next hop of the packets is changed, they are not shifted out of the list and inserted again.
+ * The new next hops are neither any of the given stations nor avoid2.
+ * @param avoid Current next hops of packets to reroute.
+ * @param avoid2 Additional station to exclude from routing and to reroute away from.
+ * @param ge GoodsEntry to get the routing info from.
+ * @param filter Cargo packet filter.
+ */
+template<class Tfilter>
+void VehicleCargoList::RerouteStaged(span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge, Tfilter filter)
+{
+	RerouteNextHopChooser chooser(ge, avoid, avoid2);
+	uint remaining = this->action_counts[MTA_TRANSFER];
+	for (Iterator it(this->packets.begin()); remaining > 0 && it != this->packets.end(); ++it) {
+		CargoPacket *cp = *it;
+		remaining -= std::min<uint>(remaining, cp->Count());
+		if (!filter(cp)) continue;
+
+		StationID next = cp->NextStation();
+		if (next == avoid2 || std::find(avoid.begin(), avoid.end(), next) != avoid.end()) {
+			cp->SetNextStation(chooser.GetVia(cp->SourceStation()));
+		}
+	}
+}
+
+/**
+ * Reroutes all cargo staged to be transferred whose next hop is one of the given stations.
+ * @param avoid Current next hops of packets to reroute.
  * @param avoid2 Additional station to exclude from routing.
  * @param ge GoodsEntry to get the routing info from.
  */
-uint VehicleCargoList::Reroute(uint max_move, VehicleCargoList *dest, StationID avoid, StationID avoid2, const GoodsEntry *ge)
+void VehicleCargoList::RerouteStaged(span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge)
 {
-	max_move = std::min(this->action_counts[MTA_TRANSFER], max_move);
-	this->ShiftCargoWithFrontInsert(VehicleCargoReroute(this, dest, max_move, avoid, avoid2, ge), [](CargoPacket *cp) { return true; });
-	return max_move;
+	this->RerouteStaged(avoid, avoid2, ge, [](const CargoPacket *cp) { return true; });
 }
 
 /**
- * Routes packets with station "avoid" as next hop to a different place, for a specific source station.
- * @param max_move Maximum amount of cargo to move.
- * @param dest List to prepend the cargo to.
+ * Reroutes all cargo staged to be transferred whose next hop is one of the given stations, for a specific source station.
  * @param source Source station.
- * @param avoid Station to exclude from routing and current next hop of packets to reroute.
+ * @param avoid Current next hops of packets to reroute.
  * @param avoid2 Additional station to exclude from routing.
  * @param ge GoodsEntry to get the routing info from.
  */
-uint VehicleCargoList::RerouteFromSource(uint max_move, VehicleCargoList *dest, StationID source, StationID avoid, StationID avoid2, const GoodsEntry *ge)
+void VehicleCargoList::RerouteStagedFromSource(StationID source, span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge)
 {
-	max_move = std::min(this->action_counts[MTA_TRANSFER], max_move);
-	this->ShiftCargoWithFrontInsert(VehicleCargoReroute(this, dest, max_move, avoid, avoid2, ge), [source](CargoPacket *cp) { return cp->SourceStation() == source; });
-	return max_move;
+	this->RerouteStaged(avoid, avoid2, ge, [source](const CargoPacket *cp) { return cp->SourceStation() == source; });
 }
 
 /*
@@ -967,67 +1023,6 @@ uint StationCargoList::ShiftCargo(Taction action, StationIDStack next, bool incl
 	return max_move - action.MaxMove();
 }
 
-/**
- * Shifts cargo from the front of the packet list for a specific station
- * from a specific source station and applies some action to it.
- * @tparam Taction Action class or function to be used. It should define
- *                 "bool operator()(CargoPacket *)". If true is returned the
- *                 cargo packet will be removed from the list. Otherwise it
- *                 will be kept and the loop will be aborted.
- * @param action Action instance to be applied.
- * @param source Source station.
- * @param next Next hop the cargo wants to visit.
- * @return True if all packets with the given next hop have been removed,
- *         False otherwise.
- */
-template <class Taction>
-bool StationCargoList::ShiftCargoFromSource(Taction &action, StationID source, StationID next)
-{
-	for (Iterator it = this->packets.lower_bound(next); it != this->packets.end() && it.GetKey() == next;) {
-		if (action.MaxMove() == 0) return false;
-		CargoPacket *cp = *it;
-		if (cp->SourceStation() != source) {
-			++it;
-			continue;
-		}
-		if (action(cp)) {
-			it = this->packets.erase(it);
-		} else {
-			return false;
-		}
-	}
-	return true;
-}
-
-/**
- * Shifts cargo from the front of the packet list for a specific station
- * and optional also from the list for "any station", then applies some action
- * to it, for a specific source station.
- * @tparam Taction Action class or function to be used. It should define
- *                 "bool operator()(CargoPacket *)". If true is returned the
- *                 cargo packet will be removed from the list. Otherwise it
- *                 will be kept and the loop will be aborted.
- * @param action Action instance to be applied.
- * @param source Source station.
- * @param next Next hop the cargo wants to visit.
- * @param include_invalid If cargo from the INVALID_STATION list should be
- *                        used if necessary.
- * @return Amount of cargo actually moved.
- */
-template <class Taction>
-uint StationCargoList::ShiftCargoFromSource(Taction action, StationID source, StationIDStack next, bool include_invalid)
-{
-	uint max_move = action.MaxMove();
-	while (!next.IsEmpty()) {
-		this->ShiftCargoFromSource(action, source, next.Pop());
-		if (action.MaxMove() == 0) break;
-	}
-	if (include_invalid && action.MaxMove() > 0) {
-		this->ShiftCargoFromSource(action, source, INVALID_STATION);
-	}
-	return max_move - action.MaxMove();
-}
-
 uint StationCargoList::AvailableViaCount(StationID next) const
 {
 	uint count = 0;
@@ -1129,29 +1124,85 @@ uint StationCargoList::Load(uint max_move, VehicleCargoList *dest, TileIndex loa
 }
 
 /**
- * Routes packets with station "avoid" as next hop to a different place.
- * @param max_move Maximum amount of cargo to move.
- * @param dest List to append the cargo to.
- * @param avoid Station to exclude from routing and current next hop of packets to reroute.
+ * Reroutes all packets with one of the given stations as next hop which match a filter.
+ * The rerouted packets are appended directly to the lists of their new next hops, instead of
+ * shifting and re-inserting them into the map one by one.
+ * @param avoid Stations to exclude from routing and current next hops of packets to reroute.
+ * @param avoid2 Additional station to exclude from routing.
+ * @param ge GoodsEntry to get the routing info from.
+ * @param filter Cargo packet filter.
+ * @return Amount of cargo rerouted.
+ */
+template<class Tfilter>
+uint StationCargoList::BulkReroute(span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge, Tfilter filter)
+{
+	RerouteNextHopChooser chooser(ge, avoid, avoid2);
+
+	/* There are usually only a few different new next hops, so a linear search is fine. */
+	std::vector<std::pair<StationID, StationCargoPacketMap::List *>> next_lists;
+	uint moved = 0;
+
+	for (StationID via : avoid) {
+		StationCargoPacketMap::MapIterator avoid_it = this->packets.find(via);
+		if (avoid_it == this->packets.end()) continue;
+
+		StationCargoPacketMap::List &list = avoid_it->second;
+		StationCargoPacketMap::ListIterator keep = list.begin();
+		for (StationCargoPacketMap::ListIterator it = list.begin(); it != list.end(); ++it) {
+			CargoPacket *cp = *it;
+			if (!filter(cp)) {
+				*keep = cp;
+				++keep;
+				continue;
+			}
+
+			StationID next = chooser.GetVia(cp->SourceStation());
+			assert(next != avoid2 && std::find(avoid.begin(), avoid.end(), next) == avoid.end());
+
+			StationCargoPacketMap::List *next_list = nullptr;
+			for (const auto &entry : next_lists) {
+				if (entry.first == next) {
+					next_list = entry.second;
+					break;
+				}
+			}
+			if (next_list == nullptr) {
+				next_list = &this->packets[next];
+				next_lists.emplace_back(next, next_list);
+			}
+			next_list->push_back(cp);
+			moved += cp->Count();
+		}
+
+		list.erase(keep, list.end());
+		if (list.empty()) this->packets.StationCargoPacketMap::Map::erase(avoid_it);
+	}
+	return moved;
+}
+
+/**
+ * Reroutes all packets with one of the given stations as next hop to a different place.
+ * @param avoid Stations to exclude from routing and current next hops of packets to reroute.
  * @param avoid2 Additional station to exclude from routing.
  * @param ge GoodsEntry to get the routing info from.
+ * @return Amount of cargo rerouted.
  */
-uint StationCargoList::Reroute(uint max_move, StationCargoList *dest, StationID avoid, StationID avoid2, const GoodsEntry *ge)
+uint StationCargoList::BulkReroute(span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge)
 {
-	return this->ShiftCargo(StationCargoReroute(this, dest, max_move, avoid, avoid2, ge), avoid, false);
+	return this->BulkReroute(avoid, avoid2, ge, [](const CargoPacket *cp) { return true; });
 }
 
 /**
- * Routes packets with station "avoid" as next hop to a different place.
- * @param max_move Maximum amount of cargo to move.
- * @param dest List to append the cargo to.
- * @param avoid Station to exclude from routing and current next hop of packets to reroute.
+ * Reroutes all packets with one of the given stations as next hop to a different place, for a specific source station.
+ * @param source Source station.
+ * @param avoid Stations to exclude from routing and current next hops of packets to reroute.
  * @param avoid2 Additional station to exclude from routing.
  * @param ge GoodsEntry to get the routing info from.
+ * @return Amount of cargo rerouted.
  */
-uint StationCargoList::RerouteFromSource(uint max_move, StationCargoList *dest, StationID source, StationID avoid, StationID avoid2, const GoodsEntry *ge)
+uint StationCargoList::BulkRerouteFromSource(StationID source, span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge)
 {
-	return this->ShiftCargoFromSource(StationCargoReroute(this, dest, max_move, avoid, avoid2, ge), source, avoid, false);
+	return this->BulkReroute(avoid, avoid2, ge, [source](const CargoPacket *cp) { return cp->SourceStation() == source; });
 }
 
 /*
@@ -18,6 +18,7 @@
 #include "vehicle_type.h"
 #include "company_type.h"
 #include "core/multimap.hpp"
+#include "core/span_type.hpp"
 #include "saveload/saveload_common.h"
 #include <deque>
 
@@ -298,12 +299,12 @@ protected:
 	template<class Taction>
 	void ShiftCargo(Taction action);
 
-	template<class Taction, class Tfilter>
-	void ShiftCargoWithFrontInsert(Taction action, Tfilter filter);
-
 	template<class Taction>
 	void PopCargo(Taction action);
 
+	template<class Tfilter>
+	void RerouteStaged(span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge, Tfilter filter);
+
 	inline uint RecalculateCargoTotal() const
 	{
 		uint total = 0;
@@ -359,7 +360,6 @@ public:
 	template<class Tsource>
 	friend class CargoRemoval;
 	friend class CargoReturn;
-	friend class VehicleCargoReroute;
 
 	/**
 	 * Returns source of the first cargo packet in this list.
@@ -466,8 +466,8 @@ public:
 	uint Unload(uint max_move, StationCargoList *dest, CargoPayment *payment);
 	uint Shift(uint max_move, VehicleCargoList *dest);
 	uint Truncate(uint max_move = UINT_MAX);
-	uint Reroute(uint max_move, VehicleCargoList *dest, StationID avoid, StationID avoid2, const GoodsEntry *ge);
-	uint RerouteFromSource(uint max_move, VehicleCargoList *dest, StationID source, StationID avoid, StationID avoid2, const GoodsEntry *ge);
+	void RerouteStaged(span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge);
+	void RerouteStagedFromSource(StationID source, span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge);
 
 	/**
 	 * Are the two CargoPackets mergeable in the context of
@@ -499,6 +499,9 @@ protected:
 
 	uint reserved_count; ///< Amount of cargo being reserved for loading.
 
+	template<class Tfilter>
+	uint BulkReroute(span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge, Tfilter filter);
+
 public:
 	/** The super class ought to know what it's doing. */
 	friend class CargoList<StationCargoList, StationCargoPacketMap>;
@@ -512,7 +515,6 @@ public:
 	friend class CargoRemoval;
 	friend class CargoReservation;
 	friend class CargoReturn;
-	friend class StationCargoReroute;
 
 	static void InvalidateAllFrom(SourceType src_type, SourceID src);
 
@@ -522,12 +524,6 @@ public:
 	template<class Taction>
 	uint ShiftCargo(Taction action, StationIDStack next, bool include_invalid);
 
-	template <class Taction>
-	bool ShiftCargoFromSource(Taction &action, StationID source, StationID next);
-
-	template<class Taction>
-	uint ShiftCargoFromSource(Taction action, StationID source, StationIDStack next, bool include_invalid);
-
 	void Append(CargoPacket *cp, StationID next);
 
 	/**
@@ -591,8 +587,8 @@ public:
 	uint Reserve(uint max_move, VehicleCargoList *dest, TileIndex load_place, StationIDStack next);
 	uint Load(uint max_move, VehicleCargoList *dest, TileIndex load_place, StationIDStack next);
 	uint Truncate(uint max_move = UINT_MAX, StationCargoAmountMap *cargo_per_source = nullptr);
-	uint Reroute(uint max_move, StationCargoList *dest, StationID avoid, StationID avoid2, const GoodsEntry *ge);
-	uint RerouteFromSource(uint max_move, StationCargoList *dest, StationID source, StationID avoid, StationID avoid2, const GoodsEntry *ge);
+	uint BulkReroute(span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge);
+	uint BulkRerouteFromSource(StationID source, span<const StationID> avoid, StationID avoid2, const GoodsEntry *ge);
 
 	void AfterLoadIncreaseReservationCount(uint count)
 	{
@@ -465,6 +465,28 @@ DEF_CONSOLE_CMD(ConSave)
 	return false;
 }
 
+DEF_CONSOLE_CMD(ConReconstructDeltaSave)
+{
+	if (argc == 0) {
+		IConsoleHelp("Rebuild a full savegame from a delta autosave and the full autosave it refers to. Usage: 'reconstruct_delta_save <delta autosave> <filename>'");
+		return true;
+	}
+
+	if (argc == 3) {
+		char *filename = str_fmt("%s.sav", argv[2]);
+		const char *error = ReconstructDeltaSave(argv[1], filename);
+		if (error != nullptr) {
+			IConsolePrintF(CC_ERROR, "Reconstructing savegame failed: %s", error);
+		} else {
+			IConsolePrintF(CC_DEFAULT, "Savegame successfully reconstructed to %s", filename);
+		}
+		free(filename);
+		return true;
+	}
+
+	return false;
+}
+
 /**
  * Explicitly save the configuration.
  * @return True.
@@ -3549,6 +3571,7 @@ void IConsoleStdLibRegister()
 	IConsole::CmdRegister("rm",                      ConRemove);
 	IConsole::CmdRegister("save",                    ConSave);
 	IConsole::CmdRegister("saveconfig",              ConSaveConfig);
+	IConsole::CmdRegister("reconstruct_delta_save",  ConReconstructDeltaSave);
 	IConsole::CmdRegister("ls",                      ConListFiles);
 	IConsole::CmdRegister("cd",                      ConChangeDirectory);
 	IConsole::CmdRegister("pwd",                     ConPrintWorkingDirectory);
@@ -100,6 +100,28 @@ DEFINE_POOL_METHOD(inline size_t)::FindFirstFree()
 	return NO_FREE_ITEM;
 }
 
+/**
+ * Allocate a slab of items and add them to the 'alloc' cache.
+ * This only saves the per item heap allocations: freed items go back on the front of the cache
+ * and are reused first, so items which belong together (e.g. the packets of one cargo list)
+ * are generally not next to each other in memory. Slabs are only freed by CleanPool.
+ * @param size size of item
+ */
+DEFINE_POOL_METHOD(inline void)::AllocateCacheSlab(size_t size)
+{
+	assert(sizeof(Titem) == size);
+
+	byte *slab = MallocT<byte>(size * ALLOC_CACHE_SLAB_ITEMS);
+	this->alloc_cache_slabs.push_back(slab);
+
+	/* Link the items in reverse, so that they are handed out in address order */
+	for (size_t i = ALLOC_CACHE_SLAB_ITEMS; i-- > 0;) {
+		AllocCache *ac = (AllocCache *)(slab + (i * size));
+		ac->next = this->alloc_cache;
+		this->alloc_cache = ac;
+	}
+}
+
 /**
  * Makes given index valid
  * @param size size of item
@@ -115,7 +137,8 @@ DEFINE_POOL_METHOD(inline void *)::AllocateItem(size_t size, size_t index)
 	this->items++;
 
 	Titem *item;
-	if (Tcache && this->alloc_cache != nullptr) {
+	if (Tcache) {
+		if (this->alloc_cache == nullptr) this->AllocateCacheSlab(size);
 		assert(sizeof(Titem) == size);
 		item = (Titem *)this->alloc_cache;
 		this->alloc_cache = this->alloc_cache->next;
@@ -222,11 +245,12 @@ DEFINE_POOL_METHOD(void)::CleanPool()
 	this->cleaning = false;
 
 	if (Tcache) {
-		while (this->alloc_cache != nullptr) {
-			AllocCache *ac = this->alloc_cache;
-			this->alloc_cache = ac->next;
-			free(ac);
+		/* All cached items are part of a slab */
+		this->alloc_cache = nullptr;
+		for (void *slab : this->alloc_cache_slabs) {
+			free(slab);
 		}
+		this->alloc_cache_slabs.clear();
 	}
 }
 
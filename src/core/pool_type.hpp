@@ -406,9 +406,15 @@ private:
 		AllocCache *next;
 	};
 
+	/** Number of items allocated at once for the 'alloc' cache. */
+	static const size_t ALLOC_CACHE_SLAB_ITEMS = 256;
+
 	/** Cache of freed pointers */
 	AllocCache *alloc_cache;
+	/** Slabs of items allocated for the 'alloc' cache when Tcache is enabled, kept until CleanPool */
+	std::vector<void *> alloc_cache_slabs;
 
+	void AllocateCacheSlab(size_t size);
 	void *AllocateItem(size_t size, size_t index);
 	void ResizeFor(size_t index);
 	size_t FindFirstFree();
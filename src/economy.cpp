@@ -57,6 +57,7 @@
 #include "pathfinder/yapf/yapf_cache.h"
 #include "debug_desync.h"
 #include "event_logs.h"
+#include "thread.h"
 
 #include "table/strings.h"
 #include "table/pricebase.h"
@@ -168,14 +169,12 @@ Money CalculateCompanyValueExcludingShares(const Company *c, bool including_loan
 }
 
 /**
- * if update is set to true, the economy is updated with this score
- *  (also the house is updated, should only be true in the on-tick event)
- * @param update the economy with calculated score
+ * Calculate the performance rating of a company, and fill in its score parts.
+ * This only writes the score parts of this company, so it may be run on a worker thread.
  * @param c company been evaluated
  * @return actual score of this company
- *
  */
-int UpdateCompanyRatingAndValue(Company *c, bool update)
+static int CalculateCompanyRating(const Company *c)
 {
 	Owner owner = c->index;
 	int score = 0;
@@ -293,6 +292,21 @@ int UpdateCompanyRatingAndValue(Company *c, bool update)
 		if (total_score != SCORE_MAX) score = score * SCORE_MAX / total_score;
 	}
 
+	return score;
+}
+
+/**
+ * if update is set to true, the economy is updated with this score
+ *  (also the house is updated, should only be true in the on-tick event)
+ * @param update the economy with calculated score
+ * @param c company been evaluated
+ * @return actual score of this company
+ *
+ */
+int UpdateCompanyRatingAndValue(Company *c, bool update)
+{
+	int score = CalculateCompanyRating(c);
+
 	if (update) {
 		c->old_economy[0].performance_history = score;
 		UpdateCompanyHQ(c->location_of_HQ, score);
@@ -753,7 +767,13 @@ static void CompaniesGenStatistics()
 	/* Only run the economic statics and update company stats every 3rd month (1st of quarter). */
 	if (!HasBit(1 << 0 | 1 << 3 | 1 << 6 | 1 << 9, _cur_date_ymd.month)) return;
 
-	for (Company *c : Company::Iterate()) {
+	std::vector<Company *> companies;
+	for (Company *c : Company::Iterate()) companies.push_back(c);
+
+	/* Each company scans all vehicles and stations for its rating and value, and only writes its own statistics */
+	RunParallelJobs(companies.size(), 1, [&](size_t idx) {
+		Company *c = companies[idx];
+
 		/* Drop the oldest history off the end */
 		std::copy_backward(c->old_economy, c->old_economy + MAX_HISTORY_QUARTERS - 1, c->old_economy + MAX_HISTORY_QUARTERS);
 		c->old_economy[0] = c->cur_economy;
@@ -761,10 +781,17 @@ static void CompaniesGenStatistics()
 
 		if (c->num_valid_stat_ent != MAX_HISTORY_QUARTERS) c->num_valid_stat_ent++;
 
-		UpdateCompanyRatingAndValue(c, true);
+		c->old_economy[0].performance_history = CalculateCompanyRating(c);
+		c->old_economy[0].company_value = CalculateCompanyValue(c);
 		if (c->block_preview != 0) c->block_preview--;
+	});
+
+	/* The HQ appearance changes the map, so do this in order afterwards */
+	for (const Company *c : companies) {
+		UpdateCompanyHQ(c->location_of_HQ, c->old_economy[0].performance_history);
 	}
 
+	SetWindowDirty(WC_PERFORMANCE_DETAIL, 0);
 	SetWindowDirty(WC_INCOME_GRAPH, 0);
 	SetWindowDirty(WC_OPERATING_PROFIT, 0);
 	SetWindowDirty(WC_DELIVERED_CARGO, 0);
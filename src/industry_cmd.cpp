@@ -44,6 +44,7 @@
 #include "cmd_helper.h"
 #include "string_func.h"
 #include "event_logs.h"
+#include "thread.h"
 
 #include "table/strings.h"
 #include "table/industry_land.h"
@@ -3011,8 +3012,17 @@ void IndustryMonthlyLoop()
 
 	_industry_builder.MonthlyLoop();
 
-	for (Industry *i : Industry::Iterate()) {
-		UpdateIndustryStatistics(i);
+	std::vector<Industry *> industries;
+	industries.reserve(Industry::GetNumItems());
+	for (Industry *i : Industry::Iterate()) industries.push_back(i);
+
+	/* The statistics roll-over only touches the industry itself */
+	RunParallelJobs(industries.size(), 512, [&](size_t idx) {
+		UpdateIndustryStatistics(industries[idx]);
+	});
+
+	/* Production changes use the random generator, and closures affect other objects, so keep these in order */
+	for (Industry *i : industries) {
 		if (i->prod_level == PRODLEVEL_CLOSURE) {
 			delete i;
 		} else {
@@ -277,6 +277,86 @@ void LinkGraph::Edge::Update(uint capacity, uint usage, EdgeUpdateMode mode)
 	if (mode & EUM_AIRCRAFT) this->edge.last_aircraft_update = _date;
 }
 
+/** Number of significant bits of the supplies and capacities which are kept in the fingerprint. */
+static const uint RECALC_FINGERPRINT_PRECISION_BITS = 5;
+
+/**
+ * Get the bucket of a value relative to the largest value of its kind in the
+ * component. The value is scaled relative to the largest value and only its
+ * most significant bits are kept, so a value has to change by about 3 to 6
+ * percent to move to another bucket.
+ * @param value Value to be classified.
+ * @param max_value Largest value of that kind in the component.
+ * @return Bucket of the value.
+ */
+static uint64 GetRecalcFingerprintBucket(uint value, uint max_value)
+{
+	if (value == 0) return 0;
+	uint64 scaled = std::max<uint64>(1, ((uint64)value << 20) / max_value);
+	uint shift = std::max<int>(0, (int)FindLastBit(scaled) - (int)(RECALC_FINGERPRINT_PRECISION_BITS - 1));
+	return ((uint64)shift << RECALC_FINGERPRINT_PRECISION_BITS) | (scaled >> shift);
+}
+
+/**
+ * Calculate a fingerprint of the properties of the component which are
+ * relevant to the distribution: the nodes, their acceptance and supply,
+ * the links, their restriction state and capacity. Supplies and capacities
+ * are bucketed relative to the largest one in the component so that
+ * compression doesn't change the fingerprint.
+ * @return Fingerprint.
+ */
+uint64 LinkGraph::CalculateRecalcFingerprint() const
+{
+	uint max_supply = 1;
+	uint max_capacity = 1;
+	for (NodeID from = 0; from < this->Size(); ++from) {
+		max_supply = std::max(max_supply, this->nodes[from].supply);
+		const BaseEdge *node_edges = this->edges[from];
+		for (NodeID to = node_edges[from].next_edge; to != INVALID_NODE; to = node_edges[to].next_edge) {
+			max_capacity = std::max(max_capacity, node_edges[to].capacity);
+		}
+	}
+
+	/* FNV-1a */
+	uint64 hash = 0xCBF29CE484222325ULL;
+	auto mix = [&](uint64 value) {
+		hash ^= value;
+		hash *= 0x100000001B3ULL;
+	};
+	mix(this->Size());
+	for (NodeID from = 0; from < this->Size(); ++from) {
+		const BaseNode &node = this->nodes[from];
+		mix(node.station | (node.demand > 0 ? 1 << 16 : 0) | (GetRecalcFingerprintBucket(node.supply, max_supply) << 17));
+		const BaseEdge *node_edges = this->edges[from];
+		for (NodeID to = node_edges[from].next_edge; to != INVALID_NODE; to = node_edges[to].next_edge) {
+			const BaseEdge &edge = node_edges[to];
+			mix(to | (edge.last_unrestricted_update != INVALID_DATE ? 1 << 16 : 0) | (edge.last_restricted_update != INVALID_DATE ? 1 << 17 : 0) |
+					(edge.last_aircraft_update != INVALID_DATE ? 1 << 18 : 0) | (GetRecalcFingerprintBucket(edge.capacity, max_capacity) << 19));
+		}
+	}
+	return hash;
+}
+
+/**
+ * Check whether the next recalculation of the component can be skipped, as
+ * it hasn't changed significantly since the last one, so that the flows of the
+ * last one remain valid. Otherwise record the current state of the component
+ * for the check before the following recalculation.
+ * @param max_skipped Maximum number of consecutive recalculations to be skipped, 0 to never skip.
+ * @return True if the recalculation should be skipped.
+ */
+bool LinkGraph::CheckSkipRecalculation(uint8 max_skipped)
+{
+	uint64 fingerprint = this->CalculateRecalcFingerprint();
+	if (fingerprint == this->recalc_fingerprint && this->recalc_skipped < max_skipped) {
+		this->recalc_skipped++;
+		return true;
+	}
+	this->recalc_fingerprint = fingerprint;
+	this->recalc_skipped = 0;
+	return false;
+}
+
 /**
  * Resize the component and fill it with empty nodes and edges. Used when
  * loading from save games. The component is expected to be empty before.
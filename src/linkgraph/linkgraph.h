@@ -476,12 +476,12 @@ public:
 	}
 
 	/** Bare constructor, only for save/load. */
-	LinkGraph() : cargo(INVALID_CARGO), last_compression(0) {}
+	LinkGraph() : cargo(INVALID_CARGO), last_compression(0), recalc_fingerprint(0), recalc_skipped(0) {}
 	/**
 	 * Real constructor.
 	 * @param cargo Cargo the link graph is about.
 	 */
-	LinkGraph(CargoID cargo) : cargo(cargo), last_compression(_date) {}
+	LinkGraph(CargoID cargo) : cargo(cargo), last_compression(_date), recalc_fingerprint(0), recalc_skipped(0) {}
 
 	void Init(uint size);
 	void ShiftDates(int interval);
@@ -541,6 +541,9 @@ public:
 	NodeID AddNode(const Station *st);
 	void RemoveNode(NodeID id);
 
+	uint64 CalculateRecalcFingerprint() const;
+	bool CheckSkipRecalculation(uint8 max_skipped);
+
 	inline uint64 CalculateCostEstimate() const {
 		uint64 size_squared = this->Size() * this->Size();
 		return size_squared * FindLastBit(size_squared * size_squared); // N^2 * 4log_2(N)
@@ -563,6 +566,8 @@ protected:
 	Date last_compression; ///< Last time the capacities and supplies were compressed.
 	NodeVector nodes;      ///< Nodes in the component.
 	EdgeMatrix edges;      ///< Edges in the component.
+	uint64 recalc_fingerprint; ///< Fingerprint of the component when a job was last spawned for it.
+	uint8 recalc_skipped;      ///< Number of consecutive recalculations skipped as the component was unchanged.
 };
 
 #endif /* LINKGRAPH_H */
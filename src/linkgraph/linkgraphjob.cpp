@@ -126,7 +126,7 @@ void LinkGraphJob::FinaliseJob()
 		FlowStatMap &flows = from.Flows();
 
 		for (EdgeIterator it(from.Begin()); it != from.End(); ++it) {
-			if (from[it->first].Flow() == 0) continue;
+			if (it->second.Flow() == 0) continue;
 			StationID to = (*this)[it->first].Station();
 			Station *st2 = Station::GetIfValid(to);
 			if (st2 == nullptr || st2->goods[this->Cargo()].link_graph != this->link_graph.index ||
@@ -148,6 +148,7 @@ void LinkGraphJob::FinaliseJob()
 		 * really delete them as we could then end up with unroutable cargo
 		 * somewhere. Do delete them and also reroute relevant cargo if
 		 * automatic distribution has been turned off for that cargo. */
+		std::vector<StationID> vias;
 		for (FlowStatMap::iterator it(ge.flows.begin()); it != ge.flows.end();) {
 			FlowStatMap::iterator new_it = flows.find(it->GetOrigin());
 			if (new_it == flows.end()) {
@@ -157,10 +158,12 @@ void LinkGraphJob::FinaliseJob()
 						FlowStat shares(INVALID_STATION, INVALID_STATION, 1);
 						it->SwapShares(shares);
 						it = ge.flows.erase(it);
+						vias.clear();
 						for (FlowStat::const_iterator shares_it(shares.begin());
 								shares_it != shares.end(); ++shares_it) {
-							RerouteCargoFromSource(st, this->Cargo(), origin, shares_it->second, st->index);
+							vias.push_back(shares_it->second);
 						}
+						RerouteCargoFromSource(st, this->Cargo(), origin, vias, st->index);
 					} else {
 						++it;
 					}
@@ -168,10 +171,12 @@ void LinkGraphJob::FinaliseJob()
 					FlowStat shares(INVALID_STATION, INVALID_STATION, 1);
 					it->SwapShares(shares);
 					it = ge.flows.erase(it);
+					vias.clear();
 					for (FlowStat::const_iterator shares_it(shares.begin());
 							shares_it != shares.end(); ++shares_it) {
-						RerouteCargo(st, this->Cargo(), shares_it->second, st->index);
+						vias.push_back(shares_it->second);
 					}
+					RerouteCargo(st, this->Cargo(), vias, st->index);
 				}
 			} else {
 				it->SwapShares(*new_it);
@@ -188,7 +193,8 @@ void LinkGraphJob::FinaliseJob()
 }
 
 /**
- * Initialize the link graph job: Resize nodes and edges and populate them.
+ * Initialize the link graph job: Resize nodes and edges and populate them,
+ * and collect the edge targets of each node into a contiguous array.
  * This is done after the constructor so that we can do it in the calculation
  * thread without delaying the main game.
  */
@@ -197,13 +203,23 @@ void LinkGraphJob::Init()
 	uint size = this->Size();
 	this->nodes.resize(size);
 	this->edges.Resize(size, size);
+	this->edge_offsets.resize(size + 1);
+	this->edge_targets.clear();
 	for (uint i = 0; i < size; ++i) {
-		this->nodes[i].Init(this->link_graph[i].Supply());
+		LinkGraph::ConstNode from = this->link_graph[i];
+		this->nodes[i].Init(from.Supply());
 		EdgeAnnotation *node_edges = this->edges[i];
 		for (uint j = 0; j < size; ++j) {
 			node_edges[j].Init();
 		}
+
+		/* Keep the next_edge order, the results of the calculation depend on it. */
+		this->edge_offsets[i] = (uint)this->edge_targets.size();
+		for (LinkGraph::ConstEdgeIterator it = from.Begin(); it != from.End(); ++it) {
+			this->edge_targets.push_back(it->first);
+		}
 	}
+	this->edge_offsets[size] = (uint)this->edge_targets.size();
 }
 
 /**
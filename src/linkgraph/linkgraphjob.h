@@ -70,6 +70,8 @@ protected:
 	DateTicks start_date_ticks;       ///< Date when the job was started.
 	NodeAnnotationVector nodes;       ///< Extra node data necessary for link graph calculation.
 	EdgeAnnotationMatrix edges;       ///< Extra edge data necessary for link graph calculation.
+	std::vector<NodeID> edge_targets; ///< Remote ends of the edges of all nodes, grouped by source node, in next_edge order.
+	std::vector<uint> edge_offsets;   ///< Index of the first edge target of each node, with a trailing end offset.
 	std::atomic<bool> job_completed;  ///< Is the job still running. This is accessed by multiple threads and reads may be stale.
 	std::atomic<bool> job_aborted;    ///< Has the job been aborted. This is accessed by multiple threads and reads may be stale.
 
@@ -153,20 +155,57 @@ public:
 	};
 
 	/**
-	 * Iterator for job edges.
+	 * Iterator for job edges. Walks the contiguous range of edge targets of a
+	 * node, instead of following the next_edge chain through the edge matrix.
 	 */
-	class EdgeIterator : public LinkGraph::BaseEdgeIterator<const LinkGraph::BaseEdge, Edge, EdgeIterator> {
-		EdgeAnnotation *base_anno; ///< Array of annotations to be (indirectly) iterated.
+	class EdgeIterator {
+		const NodeID *current;            ///< Edge target currently pointed to.
+		const LinkGraph::BaseEdge *base;  ///< Array of edges of the source node, indexed by remote end.
+		EdgeAnnotation *base_anno;        ///< Array of annotations of the source node, indexed by remote end.
+
+		/**
+		 * A "fake" pointer to enable operator-> on temporaries.
+		 * @see LinkGraph::BaseEdgeIterator::FakePointer
+		 */
+		class FakePointer : public std::pair<NodeID, Edge> {
+		public:
+			FakePointer(const std::pair<NodeID, Edge> &pair) : std::pair<NodeID, Edge>(pair) {}
+			std::pair<NodeID, Edge> *operator->() { return this; }
+		};
+
 	public:
 		/**
 		 * Constructor.
-		 * @param base Array of edges to be iterated.
-		 * @param base_anno Array of annotations to be iterated.
-		 * @param current Start offset of iteration.
+		 * @param current Edge target to start at.
+		 * @param base Array of edges of the source node.
+		 * @param base_anno Array of annotations of the source node.
+		 */
+		EdgeIterator(const NodeID *current, const LinkGraph::BaseEdge *base, EdgeAnnotation *base_anno) :
+				current(current), base(base), base_anno(base_anno) {}
+
+		/**
+		 * Prefix-increment.
+		 * @return This.
+		 */
+		EdgeIterator &operator++()
+		{
+			++this->current;
+			return *this;
+		}
+
+		/**
+		 * Postfix-increment.
+		 * @return Version of this before increment.
 		 */
-		EdgeIterator(const LinkGraph::BaseEdge *base, EdgeAnnotation *base_anno, NodeID current) :
-				LinkGraph::BaseEdgeIterator<const LinkGraph::BaseEdge, Edge, EdgeIterator>(base, current),
-				base_anno(base_anno) {}
+		EdgeIterator operator++(int)
+		{
+			EdgeIterator ret(*this);
+			++this->current;
+			return ret;
+		}
+
+		bool operator==(const EdgeIterator &other) const { return this->current == other.current; }
+		bool operator!=(const EdgeIterator &other) const { return this->current != other.current; }
 
 		/**
 		 * Dereference.
@@ -175,12 +214,11 @@ public:
 		 */
 		std::pair<NodeID, Edge> operator*() const
 		{
-			return std::pair<NodeID, Edge>(this->current, Edge(this->base[this->current], this->base_anno[this->current]));
+			return std::pair<NodeID, Edge>(*this->current, Edge(this->base[*this->current], this->base_anno[*this->current]));
 		}
 
 		/**
-		 * Dereference. Has to be repeated here as operator* is different than
-		 * in LinkGraph::EdgeWrapper.
+		 * Dereference.
 		 * @return Fake pointer to pair of NodeID/Edge.
 		 */
 		FakePointer operator->() const {
@@ -194,6 +232,7 @@ public:
 	 */
 	class Node : public LinkGraph::ConstNode {
 	private:
+		const LinkGraphJob *job;    ///< Job the node belongs to.
 		NodeAnnotation &node_anno;  ///< Annotation being wrapped.
 		EdgeAnnotation *edge_annos; ///< Edge annotations belonging to this node.
 	public:
@@ -205,7 +244,7 @@ public:
 		 */
 		Node (LinkGraphJob *lgj, NodeID node) :
 			LinkGraph::ConstNode(&lgj->link_graph, node),
-			node_anno(lgj->nodes[node]), edge_annos(lgj->edges[node])
+			job(lgj), node_anno(lgj->nodes[node]), edge_annos(lgj->edges[node])
 		{}
 
 		/**
@@ -218,17 +257,17 @@ public:
 
 		/**
 		 * Iterator for the "begin" of the edge array. Only edges with capacity
-		 * are iterated. The others are skipped.
+		 * are iterated.
 		 * @return Iterator pointing to the first edge.
 		 */
-		EdgeIterator Begin() const { return EdgeIterator(this->edges, this->edge_annos, index); }
+		EdgeIterator Begin() const { return EdgeIterator(this->job->edge_targets.data() + this->job->edge_offsets[this->index], this->edges, this->edge_annos); }
 
 		/**
 		 * Iterator for the "end" of the edge array. Only edges with capacity
-		 * are iterated. The others are skipped.
+		 * are iterated.
 		 * @return Iterator pointing beyond the last edge.
 		 */
-		EdgeIterator End() const { return EdgeIterator(this->edges, this->edge_annos, INVALID_NODE); }
+		EdgeIterator End() const { return EdgeIterator(this->job->edge_targets.data() + this->job->edge_offsets[this->index + 1], this->edges, this->edge_annos); }
 
 		/**
 		 * Get amount of supply that hasn't been delivered, yet.
@@ -76,6 +76,12 @@ void LinkGraphSchedule::SpawnNext()
 	while (used_budget < cost_budget && !this->schedule.empty()) {
 		LinkGraph *lg = this->schedule.front();
 		assert(lg == LinkGraph::Get(lg->index));
+		if (lg->CheckSkipRecalculation(_settings_game.linkgraph.recalc_skip_unchanged)) {
+			/* The flows from the last job are still valid, keep them. */
+			DEBUG(linkgraph, 3, "LinkGraphSchedule::SpawnNext(): Skipping unchanged job: id: %u, nodes: %u", lg->index, lg->Size());
+			schedule_to_back.splice(schedule_to_back.end(), this->schedule, this->schedule.begin());
+			continue;
+		}
 		this->schedule.pop_front();
 		uint64 cost = lg->CalculateCostEstimate();
 		used_budget += cost;
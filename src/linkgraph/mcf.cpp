@@ -122,7 +122,7 @@ public:
 	 * @param job Job to iterate on.
 	 */
 	GraphEdgeIterator(LinkGraphJob &job) : job(job),
-		i(nullptr, nullptr, INVALID_NODE), end(nullptr, nullptr, INVALID_NODE)
+		i(nullptr, nullptr, nullptr), end(nullptr, nullptr, nullptr)
 	{}
 
 	/**
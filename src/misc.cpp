@@ -46,6 +46,7 @@
 extern TileIndex _cur_tileloop_tile;
 extern void ClearAllSignalSpeedRestrictions();
 extern void MakeNewgameSettingsLive();
+extern void ResetDeltaAutosaveBase();
 
 void InitializeSound();
 void InitializeMusic();
@@ -75,6 +76,9 @@ void InitializeGame(uint size_x, uint size_y, bool reset_date, bool reset_settin
 	 * changing the map size. This avoids data races on the map size variables. */
 	LinkGraphSchedule::Clear();
 
+	/* Delta autosaves must not refer to autosaves of a different game. */
+	ResetDeltaAutosaveBase();
+
 	AllocateMap(size_x, size_y);
 
 	ViewportMapClearTunnelCache();
@@ -31,6 +31,7 @@ enum PacketAdminType {
 	ADMIN_PACKET_ADMIN_GAMESCRIPT,       ///< The admin sends a JSON string for the GameScript.
 	ADMIN_PACKET_ADMIN_PING,             ///< The admin sends a ping to the server, expecting a ping-reply (PONG) packet.
 	ADMIN_PACKET_ADMIN_EXTERNAL_CHAT,    ///< The admin sends a chat message from external source.
+	ADMIN_PACKET_ADMIN_TELEMETRY_FILTER, ///< The admin tells the server which objects to include in the telemetry update.
 
 	ADMIN_PACKET_SERVER_FULL = 100,      ///< The server tells the admin it cannot accept the admin.
 	ADMIN_PACKET_SERVER_BANNED,          ///< The server tells the admin it is banned.
@@ -60,6 +61,7 @@ enum PacketAdminType {
 	ADMIN_PACKET_SERVER_GAMESCRIPT,      ///< The server gives the admin information from the GameScript in JSON.
 	ADMIN_PACKET_SERVER_RCON_END,        ///< The server indicates that the remote console command has completed.
 	ADMIN_PACKET_SERVER_PONG,            ///< The server replies to a ping request from the admin.
+	ADMIN_PACKET_SERVER_TELEMETRY,       ///< The server gives the admin the changes in vehicle, station and link telemetry.
 
 	INVALID_ADMIN_PACKET = 0xFF,         ///< An invalid marker for admin packets.
 };
@@ -83,6 +85,7 @@ enum AdminUpdateType {
 	ADMIN_UPDATE_CMD_NAMES,       ///< The admin would like a list of all DoCommand names.
 	ADMIN_UPDATE_CMD_LOGGING,     ///< The admin would like to have DoCommand information.
 	ADMIN_UPDATE_GAMESCRIPT,      ///< The admin would like to have gamescript messages.
+	ADMIN_UPDATE_TELEMETRY,       ///< The admin would like to have vehicle, station and link telemetry.
 	ADMIN_UPDATE_END,             ///< Must ALWAYS be on the end of this list!! (period)
 };
 
@@ -107,6 +110,25 @@ enum AdminCompanyRemoveReason {
 	ADMIN_CRR_END,       ///< Sentinel for end.
 };
 
+/** Record types in the ADMIN_PACKET_SERVER_TELEMETRY packet. */
+enum AdminTelemetryRecord {
+	ADMIN_TR_VEHICLE,         ///< A primary vehicle was added or changed.
+	ADMIN_TR_VEHICLE_REMOVED, ///< A primary vehicle was removed, or no longer matches the filter.
+	ADMIN_TR_STATION,         ///< The cargo waiting at a station changed.
+	ADMIN_TR_STATION_REMOVED, ///< A station was removed, or no longer matches the filter.
+	ADMIN_TR_LINK,            ///< A link graph edge was added or changed.
+	ADMIN_TR_LINK_REMOVED,    ///< A link graph edge was removed, or no longer matches the filter.
+
+	ADMIN_TR_END = 0xFF,      ///< End of the records in the packet.
+};
+
+/** Sections of the telemetry update, as set in the ADMIN_PACKET_ADMIN_TELEMETRY_FILTER packet. */
+enum AdminTelemetrySection {
+	ADMIN_TS_VEHICLES,        ///< Primary vehicle positions, states and loads.
+	ADMIN_TS_STATIONS,        ///< Station waiting cargo totals.
+	ADMIN_TS_LINKS,           ///< Link graph edge capacity and usage.
+};
+
 /** Main socket handler for admin related connections. */
 class NetworkAdminSocketHandler : public NetworkTCPSocketHandler {
 protected:
@@ -175,6 +197,20 @@ protected:
 	 */
 	virtual NetworkRecvStatus Receive_ADMIN_EXTERNAL_CHAT(Packet *p);
 
+	/**
+	 * Set which objects are included in the telemetry update. The next update is still a diff against
+	 * the previously reported state, objects which no longer match the filter are reported as removed:
+	 * uint16  Bitmask of the companies to include.
+	 * uint8   Bitmask of the sections to include (see #AdminTelemetrySection).
+	 * uint16  Minimum X tile coordinate of the area to include.
+	 * uint16  Minimum Y tile coordinate of the area to include.
+	 * uint16  Maximum X tile coordinate of the area to include.
+	 * uint16  Maximum Y tile coordinate of the area to include.
+	 * @param p The packet that was just received.
+	 * @return The state the network should have.
+	 */
+	virtual NetworkRecvStatus Receive_ADMIN_TELEMETRY_FILTER(Packet *p);
+
 	/**
 	 * Execute a command on the servers console:
 	 * string  Command to be executed.
@@ -481,6 +517,45 @@ protected:
 	 */
 	virtual NetworkRecvStatus Receive_SERVER_PONG(Packet *p);
 
+	/**
+	 * Send the changes in telemetry since the previous report, a report may be split over several packets:
+	 * uint32  Current game date.
+	 * Records, each starting with a uint8 #AdminTelemetryRecord:
+	 *   #ADMIN_TR_VEHICLE:
+	 *     uint32  ID of the vehicle.
+	 *     uint8   Owner of the vehicle.
+	 *     uint8   Type of the vehicle (see #VehicleType).
+	 *     uint32  Tile of the vehicle.
+	 *     uint8   State bits: 0 stopped, 1 crashed, 2 in depot, 3 loading, 4 broken down.
+	 *     uint16  Current speed, in internal units.
+	 *     uint32  Cargo units on board of the whole consist.
+	 *     uint32  Cargo capacity of the whole consist.
+	 *   #ADMIN_TR_VEHICLE_REMOVED:
+	 *     uint32  ID of the vehicle.
+	 *   #ADMIN_TR_STATION:
+	 *     uint16  ID of the station.
+	 *     uint8   Number of cargo entries which follow, cargoes not listed have no cargo waiting.
+	 *     uint8   Cargo type.
+	 *     uint32  Cargo units waiting.
+	 *   #ADMIN_TR_STATION_REMOVED:
+	 *     uint16  ID of the station.
+	 *   #ADMIN_TR_LINK:
+	 *     uint16  ID of the source station.
+	 *     uint16  ID of the destination station.
+	 *     uint8   Cargo type.
+	 *     uint32  Capacity of the link.
+	 *     uint32  Usage of the link.
+	 *   #ADMIN_TR_LINK_REMOVED:
+	 *     uint16  ID of the source station.
+	 *     uint16  ID of the destination station.
+	 *     uint8   Cargo type.
+	 * uint8   #ADMIN_TR_END.
+	 * bool    Whether this is the last packet of the report.
+	 * @param p The packet that was just received.
+	 * @return The state the network should have.
+	 */
+	virtual NetworkRecvStatus Receive_SERVER_TELEMETRY(Packet *p);
+
 	/**
 	 * Notify the admin connection that the rcon command has finished.
 	 * string The command as requested by the admin connection.
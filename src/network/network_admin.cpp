@@ -21,6 +21,9 @@
 #include "../map_func.h"
 #include "../rev.h"
 #include "../game/game.hpp"
+#include "../vehicle_base.h"
+#include "../station_base.h"
+#include "../linkgraph/linkgraph.h"
 
 #include "../safeguards.h"
 
@@ -53,6 +56,7 @@ static const AdminUpdateFrequency _admin_update_type_frequencies[] = {
 	ADMIN_FREQUENCY_POLL,                                                                                                                                  ///< ADMIN_UPDATE_CMD_NAMES
 	                       ADMIN_FREQUENCY_AUTOMATIC,                                                                                                      ///< ADMIN_UPDATE_CMD_LOGGING
 	                       ADMIN_FREQUENCY_AUTOMATIC,                                                                                                      ///< ADMIN_UPDATE_GAMESCRIPT
+	ADMIN_FREQUENCY_POLL | ADMIN_FREQUENCY_DAILY | ADMIN_FREQUENCY_WEEKLY | ADMIN_FREQUENCY_MONTHLY | ADMIN_FREQUENCY_QUARTERLY | ADMIN_FREQUENCY_ANUALLY, ///< ADMIN_UPDATE_TELEMETRY
 };
 /** Sanity check. */
 static_assert(lengthof(_admin_update_type_frequencies) == ADMIN_UPDATE_END);
@@ -641,6 +645,175 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::SendCmdLogging(ClientID clien
 	return NETWORK_RECV_STATUS_OKAY;
 }
 
+/**
+ * Check whether an object is included by the telemetry filter.
+ * @param owner Owner of the object.
+ * @param tile Location of the object.
+ * @return True if the object is included.
+ */
+bool AdminTelemetryState::Matches(Owner owner, TileIndex tile) const
+{
+	if (owner >= MAX_COMPANIES || !HasBit(this->company_mask, owner)) return false;
+	if (tile >= MapSize()) return false;
+	uint x = TileX(tile);
+	uint y = TileY(tile);
+	return x >= this->min_x && x <= this->max_x && y >= this->min_y && y <= this->max_y;
+}
+
+/**
+ * Compare the previously reported and the current state of a telemetry section, and replace the previous state with the current state.
+ * @param previous Previously reported state.
+ * @param current Current state, this is moved into previous.
+ * @param changed Called for each item which was added or changed.
+ * @param removed Called for each item which was removed.
+ */
+template <typename K, typename V, typename TChanged, typename TRemoved>
+static void UpdateTelemetryState(btree::btree_map<K, V> &previous, btree::btree_map<K, V> &current, TChanged changed, TRemoved removed)
+{
+	auto prev_iter = previous.begin();
+	for (const auto &it : current) {
+		while (prev_iter != previous.end() && prev_iter->first < it.first) {
+			removed(prev_iter->first);
+			++prev_iter;
+		}
+		if (prev_iter != previous.end() && prev_iter->first == it.first) {
+			if (!(prev_iter->second == it.second)) changed(it.first, it.second);
+			++prev_iter;
+		} else {
+			changed(it.first, it.second);
+		}
+	}
+	for (; prev_iter != previous.end(); ++prev_iter) {
+		removed(prev_iter->first);
+	}
+	previous = std::move(current);
+}
+
+/** Send the changes in vehicle, station and link telemetry since the previous report. */
+NetworkRecvStatus ServerNetworkAdminSocketHandler::SendTelemetry()
+{
+	AdminTelemetryState &state = this->telemetry;
+
+	Packet *packet = nullptr;
+	auto finish_packet = [&](bool last) {
+		packet->Send_uint8(ADMIN_TR_END);
+		packet->Send_bool(last);
+		this->SendPacket(packet);
+		packet = nullptr;
+	};
+	/* Get a packet with space for a record of the given size, and the end of packet marker */
+	auto get_packet = [&](size_t record_size) -> Packet * {
+		if (packet != nullptr && !packet->CanWriteToPacket(record_size + 2)) finish_packet(false);
+		if (packet == nullptr) {
+			packet = new Packet(ADMIN_PACKET_SERVER_TELEMETRY);
+			packet->Send_uint32(_date);
+		}
+		return packet;
+	};
+
+	btree::btree_map<VehicleID, AdminTelemetryState::VehicleInfo> vehicles;
+	if (HasBit(state.sections, ADMIN_TS_VEHICLES)) {
+		for (const Vehicle *v : Vehicle::Iterate()) {
+			if (!v->IsPrimaryVehicle() || !state.Matches(v->owner, v->tile)) continue;
+
+			AdminTelemetryState::VehicleInfo &info = vehicles[v->index];
+			info.owner = v->owner;
+			info.type = v->type;
+			info.tile = v->tile;
+			info.state = 0;
+			if (v->vehstatus & VS_STOPPED) SetBit(info.state, 0);
+			if (v->vehstatus & VS_CRASHED) SetBit(info.state, 1);
+			if (v->IsChainInDepot()) SetBit(info.state, 2);
+			if (v->current_order.IsType(OT_LOADING)) SetBit(info.state, 3);
+			if (v->breakdown_ctr == 1) SetBit(info.state, 4);
+			info.speed = v->cur_speed;
+			info.cargo = 0;
+			info.capacity = 0;
+			for (const Vehicle *u = v; u != nullptr; u = u->Next()) {
+				info.cargo += u->cargo.StoredCount();
+				info.capacity += u->cargo_cap;
+			}
+		}
+	}
+	UpdateTelemetryState(state.vehicles, vehicles, [&](VehicleID id, const AdminTelemetryState::VehicleInfo &info) {
+		Packet *p = get_packet(22);
+		p->Send_uint8 (ADMIN_TR_VEHICLE);
+		p->Send_uint32(id);
+		p->Send_uint8 (info.owner);
+		p->Send_uint8 (info.type);
+		p->Send_uint32(info.tile);
+		p->Send_uint8 (info.state);
+		p->Send_uint16(info.speed);
+		p->Send_uint32(info.cargo);
+		p->Send_uint32(info.capacity);
+	}, [&](VehicleID id) {
+		Packet *p = get_packet(5);
+		p->Send_uint8 (ADMIN_TR_VEHICLE_REMOVED);
+		p->Send_uint32(id);
+	});
+
+	btree::btree_map<StationID, AdminTelemetryState::StationInfo> stations;
+	btree::btree_map<uint64, AdminTelemetryState::LinkInfo> links;
+	if (HasBit(state.sections, ADMIN_TS_STATIONS) || HasBit(state.sections, ADMIN_TS_LINKS)) {
+		for (const Station *st : Station::Iterate()) {
+			if (!state.Matches(st->owner, st->xy)) continue;
+
+			AdminTelemetryState::StationInfo info;
+			for (CargoID c = 0; c < NUM_CARGO; c++) {
+				const GoodsEntry &ge = st->goods[c];
+				if (HasBit(state.sections, ADMIN_TS_STATIONS)) {
+					uint count = ge.cargo.TotalCount();
+					if (count > 0) info.emplace_back(c, count);
+				}
+				if (HasBit(state.sections, ADMIN_TS_LINKS) && LinkGraph::IsValidID(ge.link_graph)) {
+					const LinkGraph &lg = *LinkGraph::Get(ge.link_graph);
+					LinkGraph::ConstNode from_node = lg[ge.node];
+					for (LinkGraph::ConstEdgeIterator i = from_node.Begin(); i != from_node.End(); ++i) {
+						StationID to = lg[i->first].Station();
+						uint64 key = ((uint64)st->index << 32) | ((uint64)to << 16) | c;
+						links[key] = { i->second.Capacity(), i->second.Usage() };
+					}
+				}
+			}
+			if (HasBit(state.sections, ADMIN_TS_STATIONS)) stations[st->index] = std::move(info);
+		}
+	}
+	UpdateTelemetryState(state.stations, stations, [&](StationID id, const AdminTelemetryState::StationInfo &info) {
+		Packet *p = get_packet(4 + (5 * info.size()));
+		p->Send_uint8 (ADMIN_TR_STATION);
+		p->Send_uint16(id);
+		p->Send_uint8 ((uint8)info.size());
+		for (const auto &it : info) {
+			p->Send_uint8 (it.first);
+			p->Send_uint32(it.second);
+		}
+	}, [&](StationID id) {
+		Packet *p = get_packet(3);
+		p->Send_uint8 (ADMIN_TR_STATION_REMOVED);
+		p->Send_uint16(id);
+	});
+	UpdateTelemetryState(state.links, links, [&](uint64 key, const AdminTelemetryState::LinkInfo &info) {
+		Packet *p = get_packet(14);
+		p->Send_uint8 (ADMIN_TR_LINK);
+		p->Send_uint16(GB(key, 32, 16));
+		p->Send_uint16(GB(key, 16, 16));
+		p->Send_uint8 (GB(key, 0, 8));
+		p->Send_uint32(info.capacity);
+		p->Send_uint32(info.usage);
+	}, [&](uint64 key) {
+		Packet *p = get_packet(6);
+		p->Send_uint8 (ADMIN_TR_LINK_REMOVED);
+		p->Send_uint16(GB(key, 32, 16));
+		p->Send_uint16(GB(key, 16, 16));
+		p->Send_uint8 (GB(key, 0, 8));
+	});
+
+	get_packet(0);
+	finish_packet(true);
+
+	return NETWORK_RECV_STATUS_OKAY;
+}
+
 /***********
  * Receiving functions
  ************/
@@ -755,6 +928,16 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::Receive_ADMIN_POLL(Packet *p)
 			this->SendCmdNames();
 			break;
 
+		case ADMIN_UPDATE_TELEMETRY:
+			/* The admin is requesting the telemetry changes, or all telemetry if d1 is UINT32_MAX. */
+			if (d1 == UINT32_MAX) {
+				this->telemetry.vehicles.clear();
+				this->telemetry.stations.clear();
+				this->telemetry.links.clear();
+			}
+			this->SendTelemetry();
+			break;
+
 		default:
 			/* An unsupported "poll" update type. */
 			DEBUG(net, 1, "[admin] Not supported poll %d (%d) from '%s' (%s).", type, d1, this->admin_name.c_str(), this->admin_version.c_str());
@@ -810,6 +993,25 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::Receive_ADMIN_EXTERNAL_CHAT(P
 	return NETWORK_RECV_STATUS_OKAY;
 }
 
+NetworkRecvStatus ServerNetworkAdminSocketHandler::Receive_ADMIN_TELEMETRY_FILTER(Packet *p)
+{
+	if (this->status == ADMIN_STATUS_INACTIVE) return this->SendError(NETWORK_ERROR_NOT_EXPECTED);
+
+	AdminTelemetryState &state = this->telemetry;
+	state.company_mask = p->Recv_uint16();
+	state.sections = p->Recv_uint8();
+	state.min_x = p->Recv_uint16();
+	state.min_y = p->Recv_uint16();
+	state.max_x = p->Recv_uint16();
+	state.max_y = p->Recv_uint16();
+
+	DEBUG(net, 6, "[admin] Telemetry filter from '%s' (%s): companies: %X, sections: %X, area: %u, %u - %u, %u", this->admin_name.c_str(), this->admin_version.c_str(),
+			state.company_mask, state.sections, state.min_x, state.min_y, state.max_x, state.max_y);
+
+	/* Objects which no longer match the filter are reported as removed in the next report */
+	return NETWORK_RECV_STATUS_OKAY;
+}
+
 /*
  * Useful wrapper functions
  */
@@ -995,6 +1197,10 @@ void NetworkAdminCmdLogging(const NetworkClientSocket *owner, const CommandPacke
 void ServerNetworkAdminSocketHandler::WelcomeAll()
 {
 	for (ServerNetworkAdminSocketHandler *as : ServerNetworkAdminSocketHandler::IterateActive()) {
+		/* The previously reported telemetry refers to the old game */
+		as->telemetry.vehicles.clear();
+		as->telemetry.stations.clear();
+		as->telemetry.links.clear();
 		as->SendWelcome();
 	}
 }
@@ -1022,6 +1228,10 @@ void NetworkAdminUpdate(AdminUpdateFrequency freq)
 						as->SendCompanyStats();
 						break;
 
+					case ADMIN_UPDATE_TELEMETRY:
+						as->SendTelemetry();
+						break;
+
 					default: NOT_REACHED();
 				}
 			}
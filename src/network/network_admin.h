@@ -13,10 +13,61 @@
 #include "network_internal.h"
 #include "core/tcp_listen.h"
 #include "core/tcp_admin.h"
+#include "../company_type.h"
+#include "../tile_type.h"
+#include "../vehicle_type.h"
+#include "../station_type.h"
+#include "../cargo_type.h"
+#include "../3rdparty/cpp-btree/btree_map.h"
+#include <vector>
 
 extern AdminIndex _redirect_console_to_admin;
 
 class ServerNetworkAdminSocketHandler;
+
+/** Filter and previously reported state of the telemetry update of an admin. */
+struct AdminTelemetryState {
+	/** Reported values of a primary vehicle. */
+	struct VehicleInfo {
+		Owner owner;
+		VehicleType type;
+		TileIndex tile;
+		uint8 state;
+		uint16 speed;
+		uint32 cargo;
+		uint32 capacity;
+
+		bool operator==(const VehicleInfo &other) const
+		{
+			return this->owner == other.owner && this->type == other.type && this->tile == other.tile && this->state == other.state &&
+					this->speed == other.speed && this->cargo == other.cargo && this->capacity == other.capacity;
+		}
+	};
+
+	/** Reported values of a link graph edge. */
+	struct LinkInfo {
+		uint32 capacity;
+		uint32 usage;
+
+		bool operator==(const LinkInfo &other) const { return this->capacity == other.capacity && this->usage == other.usage; }
+	};
+
+	typedef std::vector<std::pair<CargoID, uint32>> StationInfo; ///< Reported waiting cargo of a station, sorted by cargo.
+
+	CompanyMask company_mask = (CompanyMask)-1; ///< Companies to include.
+	uint8 sections = (uint8)-1;                 ///< Sections to include (AdminTelemetrySection).
+	uint16 min_x = 0;                           ///< Minimum X tile coordinate to include.
+	uint16 min_y = 0;                           ///< Minimum Y tile coordinate to include.
+	uint16 max_x = UINT16_MAX;                  ///< Maximum X tile coordinate to include.
+	uint16 max_y = UINT16_MAX;                  ///< Maximum Y tile coordinate to include.
+
+	btree::btree_map<VehicleID, VehicleInfo> vehicles; ///< Previously reported vehicles.
+	btree::btree_map<StationID, StationInfo> stations; ///< Previously reported stations.
+	btree::btree_map<uint64, LinkInfo> links;          ///< Previously reported links, by source station, destination station and cargo.
+
+	bool Matches(Owner owner, TileIndex tile) const;
+};
+
 /** Pool with all admin connections. */
 typedef Pool<ServerNetworkAdminSocketHandler, AdminIndex, 2, MAX_ADMINS, PT_NADMIN> NetworkAdminSocketPool;
 extern NetworkAdminSocketPool _networkadminsocket_pool;
@@ -33,6 +84,7 @@ protected:
 	NetworkRecvStatus Receive_ADMIN_RCON(Packet *p) override;
 	NetworkRecvStatus Receive_ADMIN_GAMESCRIPT(Packet *p) override;
 	NetworkRecvStatus Receive_ADMIN_PING(Packet *p) override;
+	NetworkRecvStatus Receive_ADMIN_TELEMETRY_FILTER(Packet *p) override;
 
 	NetworkRecvStatus SendProtocol();
 	NetworkRecvStatus SendPong(uint32 d1);
@@ -40,6 +92,7 @@ public:
 	AdminUpdateFrequency update_frequency[ADMIN_UPDATE_END]; ///< Admin requested update intervals.
 	std::chrono::steady_clock::time_point connect_time;      ///< Time of connection.
 	NetworkAddress address;                                  ///< Address of the admin.
+	AdminTelemetryState telemetry;                           ///< Telemetry filter and previously reported state.
 
 	ServerNetworkAdminSocketHandler(SOCKET s);
 	~ServerNetworkAdminSocketHandler();
@@ -69,6 +122,7 @@ public:
 	NetworkRecvStatus SendCmdNames();
 	NetworkRecvStatus SendCmdLogging(ClientID client_id, const CommandPacket *cp);
 	NetworkRecvStatus SendRconEnd(const std::string_view command);
+	NetworkRecvStatus SendTelemetry();
 
 	static void Send();
 	static void AcceptConnection(SOCKET s, const NetworkAddress &address);
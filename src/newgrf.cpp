@@ -236,7 +236,7 @@ public:
 	}
 };
 
-static GrfProcessingState _cur;
+static thread_local GrfProcessingState _cur; ///< Per thread, as the file scan stages of several GRFs may be run concurrently.
 
 
 /**
@@ -5389,20 +5389,22 @@ static void FeatureChangeInfo(ByteReader *buf)
 /* Action 0x00 (GLS_SAFETYSCAN) */
 static void SafeChangeInfo(ByteReader *buf)
 {
-	GrfSpecFeatureRef feature = ReadFeature(buf->ReadByte());
+	/* Action 14 is not processed in this stage, so there is no GRFFile with
+	 * feature or property remappings: use the IDs as they are. */
+	uint8 feature = buf->ReadByte();
 	uint8 numprops = buf->ReadByte();
 	uint numinfo = buf->ReadByte();
 	buf->ReadExtendedByte(); // id
 
-	if (feature.id == GSF_BRIDGES && numprops == 1) {
-		GRFFilePropertyDescriptor desc = ReadAction0PropertyID(buf, feature.id);
+	if (feature == GSF_BRIDGES && numprops == 1) {
+		uint8 prop = buf->ReadByte();
 		/* Bridge property 0x0D is redefinition of sprite layout tables, which
 		 * is considered safe. */
-		if (desc.prop == 0x0D) return;
-	} else if (feature.id == GSF_GLOBALVAR && numprops == 1) {
-		GRFFilePropertyDescriptor desc = ReadAction0PropertyID(buf, feature.id);
+		if (prop == 0x0D) return;
+	} else if (feature == GSF_GLOBALVAR && numprops == 1) {
+		uint8 prop = buf->ReadByte();
 		/* Engine ID Mappings are safe, if the source is static */
-		if (desc.prop == 0x11) {
+		if (prop == 0x11) {
 			bool is_safe = true;
 			for (uint i = 0; i < numinfo; i++) {
 				uint32 s = buf->ReadDWord();
@@ -10594,7 +10596,7 @@ static bool ChangeGRFMinVersion(size_t len, ByteReader *buf)
 	return true;
 }
 
-static GRFParameterInfo *_cur_parameter; ///< The parameter which info is currently changed by the newgrf.
+static thread_local GRFParameterInfo *_cur_parameter; ///< The parameter which info is currently changed by the newgrf.
 
 /** Callback function for 'INFO'->'PARAM'->param_num->'NAME' to set the name of a parameter. */
 static bool ChangeGRFParamName(byte langid, const char *str)
@@ -12662,8 +12664,9 @@ static void DecodeSpecialSprite(byte *buf, uint num, GrfLoadingStage stage)
  * @param config The configuration of the to be loaded NewGRF.
  * @param stage  The loading stage of the NewGRF.
  * @param file   The file to load the GRF data from.
+ * @param sprite_index Sprite index of the file, or nullptr if it isn't indexed.
  */
-static void LoadNewGRFFileFromFile(GRFConfig *config, GrfLoadingStage stage, SpriteFile &file)
+static void LoadNewGRFFileFromFile(GRFConfig *config, GrfLoadingStage stage, SpriteFile &file, const GRFSpriteIndex *sprite_index)
 {
 	_cur.file = &file;
 	_cur.grfconfig = config;
@@ -12709,7 +12712,10 @@ static void LoadNewGRFFileFromFile(GRFConfig *config, GrfLoadingStage stage, Spr
 
 	ReusableBuffer<byte> buf;
 
-	while ((num = (grf_container_version >= 2 ? file.ReadDword() : file.ReadWord())) != 0) {
+	for (;;) {
+		size_t sprite_pos = file.GetPos();
+		num = grf_container_version >= 2 ? file.ReadDword() : file.ReadWord();
+		if (num == 0) break;
 		byte type = file.ReadByte();
 		_cur.nfo_line++;
 
@@ -12731,7 +12737,11 @@ static void LoadNewGRFFileFromFile(GRFConfig *config, GrfLoadingStage stage, Spr
 				break;
 			}
 
-			if (grf_container_version >= 2 && type == 0xFD) {
+			size_t next_pos = GetGRFSpriteIndexPosAfterSprite(sprite_index, sprite_pos, num);
+			if (next_pos != 0) {
+				/* Step over the sprite using the sprite index. */
+				file.SeekTo(next_pos, SEEK_SET);
+			} else if (grf_container_version >= 2 && type == 0xFD) {
 				/* Reference to data section. Container version >= 2 only. */
 				file.SkipBytes(num);
 			} else {
@@ -12775,11 +12785,12 @@ void LoadNewGRFFile(GRFConfig *config, GrfLoadingStage stage, Subdirectory subdi
 	bool needs_palette_remap = config->palette & GRFP_USE_MASK;
 	if (temporary) {
 		SpriteFile temporarySpriteFile(filename, subdir, needs_palette_remap);
-		LoadNewGRFFileFromFile(config, stage, temporarySpriteFile);
+		LoadNewGRFFileFromFile(config, stage, temporarySpriteFile, nullptr);
 	} else {
 		SpriteFile &file = OpenCachedSpriteFile(filename, subdir, needs_palette_remap);
-		LoadNewGRFFileFromFile(config, stage, file);
+		LoadNewGRFFileFromFile(config, stage, file, GetGRFSpriteIndex(file, config->ident.md5sum));
 		file.flags |= SFF_USERGRF;
+		memcpy(file.md5sum, config->ident.md5sum, sizeof(file.md5sum));
 		if (config->ident.grfid == BSWAP32(0xFF4F4701)) file.flags |= SFF_OGFX;
 	}
 }
@@ -13125,6 +13136,32 @@ void LoadNewGRF(uint load_index, uint num_baseset)
 
 	_cur.spriteid = load_index;
 
+	/* Index the files up front: this only depends on the contents of each
+	 * file, so it can be done for all of them at once.
+	 * The files are selected the same way as in the label scan stage below,
+	 * which also loads the GCF_INIT_ONLY files. */
+	{
+		std::vector<std::pair<SpriteFile *, const uint8 *>> files;
+		uint num_grfs = 0;
+		uint num_non_static = 0;
+		for (GRFConfig *c = _grfconfig; c != nullptr; c = c->next) {
+			if (c->status == GCS_DISABLED || c->status == GCS_NOT_FOUND) continue;
+
+			Subdirectory subdir = num_grfs < num_baseset ? BASESET_DIR : NEWGRF_DIR;
+			if (!FioCheckFileExists(c->filename, subdir)) continue;
+
+			if (!HasBit(c->flags, GCF_STATIC) && !HasBit(c->flags, GCF_SYSTEM)) {
+				if (num_non_static == MAX_NON_STATIC_GRF_COUNT) continue;
+				num_non_static++;
+			}
+
+			num_grfs++;
+
+			files.emplace_back(&OpenCachedSpriteFile(c->filename, subdir, c->palette & GRFP_USE_MASK), c->ident.md5sum);
+		}
+		PrepareGRFSpriteIndices(files);
+	}
+
 	/* Load newgrf sprites
 	 * in each loading stage, (try to) open each file specified in the config
 	 * and load information from it. */
@@ -13195,6 +13232,7 @@ void LoadNewGRF(uint load_index, uint num_baseset)
 	/* Pseudo sprite processing is finished; free temporary stuff */
 	_cur.ClearDataForNextFile();
 	_callback_result_cache.clear();
+	ClearGRFSpriteIndexCache();
 
 	/* Call any functions that should be run after GRFs have been loaded. */
 	AfterLoadGRFs();
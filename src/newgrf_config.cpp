@@ -30,6 +30,7 @@
 #include "thread.h"
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
 #if defined(__MINGW32__)
 #include "3rdparty/mingw-std-threads/mingw.mutex.h"
 #include "3rdparty/mingw-std-threads/mingw.condition_variable.h"
@@ -449,13 +450,14 @@ static bool CalcGRFMD5Sum(GRFConfig *config, Subdirectory subdir)
 
 
 /**
- * Find the GRFID of a given grf, and calculate its md5sum.
+ * Find the GRFID of a given grf, and perform the safety scan for static grfs.
+ * This only reads the given file and writes the given config, so may be called from a worker thread.
  * @param config    grf to fill.
  * @param is_static grf is static.
  * @param subdir    the subdirectory to search in.
  * @return Operation was successfully completed.
  */
-bool FillGRFDetails(GRFConfig *config, bool is_static, Subdirectory subdir)
+static bool ScanGRFDetails(GRFConfig *config, bool is_static, Subdirectory subdir)
 {
 	if (!FioCheckFileExists(config->filename, subdir)) {
 		config->status = GCS_NOT_FOUND;
@@ -478,7 +480,80 @@ bool FillGRFDetails(GRFConfig *config, bool is_static, Subdirectory subdir)
 		if (HasBit(config->flags, GCF_UNSAFE)) return false;
 	}
 
-	return CalcGRFMD5Sum(config, subdir);
+	return true;
+}
+
+/**
+ * Find the GRFID of a given grf, and calculate its md5sum.
+ * @param config    grf to fill.
+ * @param is_static grf is static.
+ * @param subdir    the subdirectory to search in.
+ * @return Operation was successfully completed.
+ */
+bool FillGRFDetails(GRFConfig *config, bool is_static, Subdirectory subdir)
+{
+	return ScanGRFDetails(config, is_static, subdir) && CalcGRFMD5Sum(config, subdir);
+}
+
+/**
+ * Fill the details of several grfs, see FillGRFDetails.
+ * The file and safety scans are run on a pool of worker threads, as they only depend on the
+ * grf being scanned. The md5sum calculation and \a proc are run on the calling thread, in the
+ * order of the list, so the results are the same as calling FillGRFDetails for each grf in turn.
+ * @param configs   grfs to fill.
+ * @param is_static grfs are static.
+ * @param subdir    the subdirectory to search in.
+ * @param proc      called for each grf in list order, with the result of FillGRFDetails.
+ */
+void FillGRFDetailsList(const std::vector<GRFConfig *> &configs, bool is_static, Subdirectory subdir, std::function<void(GRFConfig *, bool)> proc)
+{
+	enum ScanState : uint8 {
+		SS_PENDING,
+		SS_FAILED,
+		SS_SUCCESS,
+	};
+
+	std::mutex lock;
+	std::condition_variable done_cv;
+	std::vector<ScanState> states(configs.size(), SS_PENDING);
+	std::atomic<size_t> next_job(0);
+	auto worker = [&]() {
+		size_t i;
+		while ((i = next_job++) < configs.size()) {
+			/* Do not bother scanning any more files if the game is being closed. */
+			bool success = !_exit_game && ScanGRFDetails(configs[i], is_static, subdir);
+			std::lock_guard<std::mutex> lk(lock);
+			states[i] = success ? SS_SUCCESS : SS_FAILED;
+			done_cv.notify_one();
+		}
+	};
+
+	uint parallel = std::thread::hardware_concurrency();
+	if (parallel <= 1) parallel = 0;
+
+	std::vector<std::thread> threads;
+	for (uint i = 0; i < std::min<uint>(parallel, (uint)configs.size()); i++) {
+		std::thread thread;
+		if (!StartNewThread(&thread, "ottd:grf-scan", [&]() { worker(); })) break;
+		threads.push_back(std::move(thread));
+	}
+	/* No threads available, scan the files on this thread instead. */
+	if (threads.empty()) worker();
+
+	for (size_t i = 0; i < configs.size(); i++) {
+		bool success;
+		{
+			std::unique_lock<std::mutex> lk(lock);
+			done_cv.wait(lk, [&]() { return states[i] != SS_PENDING; });
+			success = states[i] == SS_SUCCESS;
+		}
+		if (success) success = CalcGRFMD5Sum(configs[i], subdir);
+		proc(configs[i], success);
+	}
+
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
 }
 
 
@@ -673,6 +748,7 @@ int _skip_all_newgrf_scanning = 0;
 class GRFFileScanner : FileScanner {
 	std::chrono::steady_clock::time_point next_update; ///< The next moment we do update the screen.
 	uint num_scanned; ///< The number of GRFs we have scanned.
+	std::vector<GRFConfig *> found; ///< The GRFs found by the file scanner, still to be scanned for their details.
 	std::vector<GRFConfig *> grfs;
 
 public:
@@ -682,6 +758,7 @@ public:
 	}
 
 	bool AddFile(const std::string &filename, size_t basepath_length, const std::string &tar_filename) override;
+	bool ScannedFile(GRFConfig *c, bool added);
 
 	/** Do the scan for GRFs. */
 	static uint DoScan()
@@ -694,7 +771,11 @@ public:
 		CalcGRFMD5ThreadingStart();
 		GRFFileScanner fs;
 		fs.grfs.clear();
-		int ret = fs.Scan(".grf", NEWGRF_DIR);
+		fs.Scan(".grf", NEWGRF_DIR);
+		int ret = 0;
+		FillGRFDetailsList(fs.found, false, NEWGRF_DIR, [&](GRFConfig *c, bool added) {
+			if (fs.ScannedFile(c, added)) ret++;
+		});
 		CalcGRFMD5ThreadingEnd();
 
 		for (GRFConfig *c : fs.grfs) {
@@ -739,9 +820,25 @@ bool GRFFileScanner::AddFile(const std::string &filename, size_t basepath_length
 	/* Abort if the user stopped the game during a scan. */
 	if (_exit_game) return false;
 
-	GRFConfig *c = new GRFConfig(filename.c_str() + basepath_length);
+	/* The details are filled afterwards, for all files at once. */
+	this->found.push_back(new GRFConfig(filename.c_str() + basepath_length));
+	return true;
+}
+
+/**
+ * Handle a file of which the details have been filled.
+ * @param c The GRF.
+ * @param added Whether FillGRFDetails was successful.
+ * @return Whether the GRF was added.
+ */
+bool GRFFileScanner::ScannedFile(GRFConfig *c, bool added)
+{
+	/* Abort if the user stopped the game during a scan. */
+	if (_exit_game) {
+		delete c;
+		return false;
+	}
 
-	bool added = FillGRFDetails(c, false);
 	if (added) {
 		this->grfs.push_back(c);
 	}
@@ -18,6 +18,9 @@
 #include "textfile_type.h"
 #include "newgrf_text.h"
 
+#include <functional>
+#include <vector>
+
 static const uint MAX_NON_STATIC_GRF_COUNT = 256;
 
 /** GRF config bit flags */
@@ -239,6 +242,7 @@ void ClearGRFConfigList(GRFConfig **config);
 void ResetGRFConfig(bool defaults);
 GRFListCompatibility IsGoodGRFConfigList(GRFConfig *grfconfig);
 bool FillGRFDetails(GRFConfig *config, bool is_static, Subdirectory subdir = NEWGRF_DIR);
+void FillGRFDetailsList(const std::vector<GRFConfig *> &configs, bool is_static, Subdirectory subdir, std::function<void(GRFConfig *, bool)> proc);
 char *GRFBuildParamList(char *dst, const GRFConfig *c, const char *last);
 
 /* In newgrf_gui.cpp */
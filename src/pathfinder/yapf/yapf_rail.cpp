@@ -66,6 +66,17 @@ template <typename Tpf> void DumpState(Tpf &pf1, Tpf &pf2)
 	fclose(f2);
 }
 
+/**
+ * Run the main pathfinder loop, with caching of trace restrict program results enabled.
+ * The train, slot and counter state does not change during the node search.
+ */
+template <class Tpf>
+static inline bool FindPathWithTraceRestrictCache(Tpf &pf, const Train *v)
+{
+	TraceRestrictExecutionCacheScope tr_cache_scope;
+	return pf.FindPath(v);
+}
+
 template <class Types>
 class CYapfReserveTrack
 {
@@ -359,7 +370,7 @@ public:
 		Yapf().SetMaxCost(max_penalty);
 
 		/* find the best path */
-		if (!Yapf().FindPath(v)) return FindDepotData();
+		if (!FindPathWithTraceRestrictCache(Yapf(), v)) return FindDepotData();
 
 		/* Some path found. */
 		Node *n = Yapf().GetBestNode();
@@ -442,7 +453,7 @@ public:
 		Yapf().SetOrigin(t1, td);
 		Yapf().SetDestination(v, override_railtype);
 
-		bool bFound = Yapf().FindPath(v);
+		bool bFound = FindPathWithTraceRestrictCache(Yapf(), v);
 		if (found_path) *found_path = bFound;
 		if (!bFound) return false;
 
@@ -553,7 +564,7 @@ public:
 		Yapf().SetDestination(v);
 
 		/* find the best path */
-		path_found = Yapf().FindPath(v);
+		path_found = FindPathWithTraceRestrictCache(Yapf(), v);
 
 		/* if path not found - return INVALID_TRACKDIR */
 		Trackdir next_trackdir = INVALID_TRACKDIR;
@@ -611,7 +622,7 @@ public:
 		Yapf().SetDestination(v);
 
 		/* find the best path */
-		bool bFound = Yapf().FindPath(v);
+		bool bFound = FindPathWithTraceRestrictCache(Yapf(), v);
 
 		if (!bFound) return false;
 
@@ -92,6 +92,27 @@ struct TrainReservationLookAhead {
 	std::deque<TrainReservationLookAheadCurve> curves;
 	int32 cached_zpos = 0;                ///< Cached z position as used in TrainDecelerationStats
 	uint8 zpos_refresh_remaining = 0;     ///< Remaining position updates before next refresh of cached_zpos
+	uint32 items_version = 0;             ///< Incremented whenever items is changed, used to invalidate speed_cache
+
+	/** Cached result of applying the lookahead to the train's speed limits, see Train::GetCurrentMaxSpeedInfoInternal */
+	struct SpeedCache {
+		uint32 items_version = 0;         ///< items_version when the cache was filled
+		int32 valid_from = 0;             ///< First position for which the cached result is valid
+		int32 valid_until = -1;           ///< Last position for which the cached result is valid
+		int32 reservation_end_position;   ///< Input: reservation end position
+		int16 reservation_end_z;          ///< Input: reservation end z
+		uint16 flags;                     ///< Input: lookahead flags
+		int32 z_pos;                      ///< Input: train z position
+		int deceleration_x2;              ///< Input: train deceleration
+		int uncapped_deceleration_x2;     ///< Input: train uncapped deceleration
+		int in_max_speed;                 ///< Input: max speed before applying the lookahead
+		int in_advisory_max_speed;        ///< Input: advisory max speed before applying the lookahead
+		uint8 slope_steepness;            ///< Input: train slope steepness setting
+		uint8 acceleration_model;         ///< Input: train acceleration model setting
+		int out_max_speed;                ///< Output: max speed after applying the lookahead
+		int out_advisory_max_speed;       ///< Output: advisory max speed after applying the lookahead
+	};
+	SpeedCache speed_cache;               ///< Speed cache, not saved
 
 	int32 RealEndPosition() const
 	{
@@ -102,24 +123,28 @@ struct TrainReservationLookAhead {
 	{
 		int end = this->RealEndPosition();
 		this->items.push_back({ end, end + (((int)TILE_SIZE) * tiles), z_pos, id, TRLIT_STATION });
+		this->items_version++;
 	}
 
 	void AddReverse(int16 z_pos)
 	{
 		int end = this->RealEndPosition();
 		this->items.push_back({ end, end, z_pos, 0, TRLIT_REVERSE });
+		this->items_version++;
 	}
 
 	void AddTrackSpeedLimit(uint16 speed, int offset, int duration, int16 z_pos)
 	{
 		int end = this->RealEndPosition();
 		this->items.push_back({ end + offset, end + offset + duration, z_pos, speed, TRLIT_TRACK_SPEED });
+		this->items_version++;
 	}
 
 	void AddSpeedRestriction(uint16 speed, int offset, int duration, int16 z_pos)
 	{
 		int end = this->RealEndPosition();
 		this->items.push_back({ end + offset, end + offset + duration, z_pos, speed, TRLIT_SPEED_RESTRICTION });
+		this->items_version++;
 		this->speed_restriction = speed;
 	}
 
@@ -127,12 +152,14 @@ struct TrainReservationLookAhead {
 	{
 		int end = this->RealEndPosition();
 		this->items.push_back({ end + offset, end + offset, z_pos, target_speed, TRLIT_SIGNAL });
+		this->items_version++;
 	}
 
 	void AddCurveSpeedLimit(uint16 target_speed, int offset, int16 z_pos)
 	{
 		int end = this->RealEndPosition();
 		this->items.push_back({ end + offset, end + offset, z_pos, target_speed, TRLIT_CURVE_SPEED });
+		this->items_version++;
 	}
 
 	void SetNextExtendPosition();
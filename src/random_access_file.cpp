@@ -23,7 +23,7 @@
  */
 RandomAccessFile::RandomAccessFile(const std::string &filename, Subdirectory subdir) : filename(filename)
 {
-	this->file_handle = FioFOpenFile(filename, "rb", subdir);
+	this->file_handle = FioFOpenFile(filename, "rb", subdir, &this->file_size);
 	if (this->file_handle == nullptr) usererror("Cannot open file '%s'", filename.c_str());
 
 	/* When files are in a tar-file, the begin of the file might not be at 0. */
@@ -66,6 +66,15 @@ const std::string &RandomAccessFile::GetSimplifiedFilename() const
 	return this->simplified_filename;
 }
 
+/**
+ * Get the size of the file.
+ * @return Size of the file, for files in a tar file only the size of the contained file.
+ */
+size_t RandomAccessFile::GetSize() const
+{
+	return this->file_size;
+}
+
 /**
  * Get position in the file.
  * @return Position in the file.
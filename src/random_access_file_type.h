@@ -29,6 +29,7 @@ class RandomAccessFile {
 	std::string simplified_filename; ///< Simplified lowecase name of the file; only the name, no path or extension.
 
 	FILE *file_handle;               ///< File handle of the open file.
+	size_t file_size;                ///< Size of the file.
 	size_t pos;                      ///< Position in the file of the end of the read buffer.
 
 	byte *buffer;                    ///< Current position within the local buffer.
@@ -48,6 +49,7 @@ public:
 
 	const std::string &GetFilename() const;
 	const std::string &GetSimplifiedFilename() const;
+	size_t GetSize() const;
 
 	size_t GetPos() const;
 	void SeekTo(size_t pos, int mode);
@@ -312,6 +312,8 @@ void RoadStop::ChangeDriveThroughDisallowedRoadDirections(DisallowedRoadDirectio
  */
 void RoadStop::Leave(RoadVehicle *rv)
 {
+	Station::GetByTile(this->xy)->RoadStopReservationChanged();
+
 	if (IsStandardRoadStopTile(rv->tile)) {
 		/* Vehicle is leaving a road stop tile, mark bay as free */
 		this->FreeBay(HasBit(rv->state, RVS_USING_SECOND_BAY));
@@ -342,12 +344,15 @@ bool RoadStop::Enter(RoadVehicle *rv)
 
 		/* Mark the station entrance as busy */
 		this->SetEntranceBusy(true);
+		Station::GetByTile(this->xy)->RoadStopReservationChanged();
 		return true;
 	}
 
 	/* Vehicles entering a drive-through stop from the 'normal' side use first bay (bay 0). */
 	this->GetEntry(rv)->Enter(rv);
 
+	Station::GetByTile(this->xy)->RoadStopReservationChanged();
+
 	/* Indicate a drive-through stop */
 	SetBit(rv->state, RVS_IN_DT_ROAD_STOP);
 	return true;
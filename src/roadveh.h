@@ -120,6 +120,15 @@ struct RoadVehicle FINAL : public GroundVehicle<RoadVehicle, VEH_ROAD> {
 
 	byte critical_breakdown_count; ///< Counter for the number of critical breakdowns since last service
 
+	TileIndex route_hold_tile = INVALID_TILE;       ///< Tile for which the last route choice is held while queueing for #route_hold_station, or INVALID_TILE.
+	StationID route_hold_station = INVALID_STATION; ///< Station whose road stop reservations release the held route choice.
+	Trackdir route_hold_trackdir = INVALID_TRACKDIR; ///< Held route choice for #route_hold_tile.
+	uint32 route_hold_layout_ctr = 0;               ///< Value of _road_layout_change_counter when the route choice was held.
+
+	RoadVehicle *tile_occupancy_next;               ///< NOSAVE: Next road vehicle on the same tile.
+	RoadVehicle **tile_occupancy_prev;              ///< NOSAVE: Previous road vehicle on the same tile.
+	TileIndex tile_occupancy_tile = INVALID_TILE;   ///< NOSAVE: Tile this vehicle is currently listed on in the road vehicle tile index.
+
 	/** We don't want GCC to zero our struct! It already is zeroed and has an index! */
 	RoadVehicle() : GroundVehicleBase() {}
 	/** We want to 'destruct' the right class. */
@@ -137,6 +146,9 @@ struct RoadVehicle FINAL : public GroundVehicle<RoadVehicle, VEH_ROAD> {
 	Money GetRunningCost() const;
 	int GetDisplayImageWidth(Point *offset = nullptr) const;
 	bool IsInDepot() const { return this->state == RVSB_IN_DEPOT; }
+
+	void HoldRouteChoice(TileIndex tile, Trackdir trackdir);
+	void ClearRouteHold();
 	bool Tick();
 	void OnNewDay();
 	void OnPeriodic();
@@ -666,6 +666,51 @@ TileIndex RoadVehicle::GetOrderStationLocation(StationID station)
 	return st->xy;
 }
 
+/**
+ * Hold the route choice made for a tile while this vehicle queues for its destination station.
+ * Until one of the road stop reservations of that station changes, further attempts to enter
+ * \a tile reuse \a trackdir instead of running the pathfinder again.
+ * @param tile The tile the choice was made for.
+ * @param trackdir The chosen trackdir.
+ */
+void RoadVehicle::HoldRouteChoice(TileIndex tile, Trackdir trackdir)
+{
+	if (!this->current_order.IsType(OT_GOTO_STATION)) return;
+
+	Station *st = Station::GetIfValid(this->current_order.GetDestination());
+	if (st == nullptr) return;
+
+	if (this->route_hold_station != st->index) {
+		this->ClearRouteHold();
+		st->road_waiting_vehicles.push_back(this);
+	}
+	this->route_hold_tile = tile;
+	this->route_hold_station = st->index;
+	this->route_hold_trackdir = trackdir;
+
+	/* Any later road layout change releases the hold as well */
+	this->route_hold_layout_ctr = _road_layout_change_counter;
+}
+
+/**
+ * Drop any held route choice, and leave the waiting list of the station it was held for.
+ */
+void RoadVehicle::ClearRouteHold()
+{
+	if (this->route_hold_station != INVALID_STATION) {
+		Station *st = Station::GetIfValid(this->route_hold_station);
+		if (st != nullptr) {
+			auto iter = std::find(st->road_waiting_vehicles.begin(), st->road_waiting_vehicles.end(), this);
+			if (iter != st->road_waiting_vehicles.end()) {
+				*iter = st->road_waiting_vehicles.back();
+				st->road_waiting_vehicles.pop_back();
+			}
+		}
+	}
+	this->route_hold_tile = INVALID_TILE;
+	this->route_hold_station = INVALID_STATION;
+}
+
 static void StartRoadVehSound(const RoadVehicle *v)
 {
 	if (!PlayVehicleSound(v, VSE_START)) {
@@ -1245,6 +1290,15 @@ static Trackdir RoadFindPathToDest(RoadVehicle *v, TileIndex tile, DiagDirection
 		v->path.clear();
 	}
 
+	/* Reuse the choice held while queueing, nothing which the choice depends on at the destination has changed since */
+	if (v->route_hold_tile != INVALID_TILE) {
+		if (v->route_hold_tile == tile && v->route_hold_layout_ctr == _road_layout_change_counter && v->current_order.IsType(OT_GOTO_STATION) &&
+				v->current_order.GetDestination() == v->route_hold_station && HasBit(trackdirs, v->route_hold_trackdir)) {
+			return_track(v->route_hold_trackdir);
+		}
+		v->ClearRouteHold();
+	}
+
 	/* Attempt to follow cached path. */
 	if (!v->path.empty()) {
 		if (v->path.tile.front() != tile) {
@@ -1801,6 +1855,7 @@ again:
 			Vehicle *u = RoadVehFindCloseTo(v, x, y, new_dir);
 			if (u != nullptr) {
 				v->cur_speed = u->First()->cur_speed;
+				if (!IsReversingRoadTrackdir(dir)) v->HoldRouteChoice(tile, dir);
 				return false;
 			}
 		}
@@ -1809,6 +1864,7 @@ again:
 		if (HasBit(r, VETS_CANNOT_ENTER)) {
 			if (!IsTileType(tile, MP_TUNNELBRIDGE)) {
 				v->cur_speed = 0;
+				if (v->IsFrontEngine() && !IsReversingRoadTrackdir(dir)) v->HoldRouteChoice(tile, dir);
 				return false;
 			}
 			/* Try an about turn to re-enter the previous tile */
@@ -1816,6 +1872,8 @@ again:
 			goto again;
 		}
 
+		if (v->IsFrontEngine() && v->route_hold_tile != INVALID_TILE) v->ClearRouteHold();
+
 		if (IsInsideMM(v->state, RVSB_IN_ROAD_STOP, RVSB_IN_DT_ROAD_STOP_END) && IsTileType(v->tile, MP_STATION)) {
 			if (IsReversingRoadTrackdir(dir) && IsInsideMM(v->state, RVSB_IN_ROAD_STOP, RVSB_IN_ROAD_STOP_END)) {
 				/* New direction is trying to turn vehicle around.
@@ -2039,6 +2097,7 @@ again:
 			}
 
 			rs->SetEntranceBusy(false);
+			st->RoadStopReservationChanged();
 			SetBit(v->state, RVS_ENTERED_STOP);
 
 			v->last_station_visited = st->index;
@@ -2067,7 +2126,10 @@ again:
 			}
 		}
 
-		if (IsStandardRoadStopTile(v->tile)) rs->SetEntranceBusy(true);
+		if (IsStandardRoadStopTile(v->tile)) {
+			rs->SetEntranceBusy(true);
+			st->RoadStopReservationChanged();
+		}
 
 		StartRoadVehSound(v);
 		SetWindowWidgetDirty(WC_VEHICLE_VIEW, v->index, WID_VV_START_STOP);
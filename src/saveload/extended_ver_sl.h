@@ -126,6 +126,8 @@ enum SlXvFeatureIndex {
 	XSLFI_RV_ORDER_EXTRA_FLAGS,                   ///< Road vehicle order extra flags
 	XSLFI_GRF_ROADSTOPS,                          ///< NewGRF road stops
 	XSLFI_INDUSTRY_ANIM_MASK,                     ///< Industry tile animation masking
+	XSLFI_LINKGRAPH_INCREMENTAL,                  ///< Link graph recalculation fingerprint and skipping unchanged components
+	XSLFI_RV_ROUTE_HOLD,                          ///< Road vehicle route choice held while queueing for a station
 
 	XSLFI_SCRIPT_INT64,                           ///< See: SLV_SCRIPT_INT64
 
@@ -34,6 +34,8 @@ SaveLoadTable GetLinkGraphDesc()
 		 SLE_VAR(LinkGraph, last_compression, SLE_INT32),
 		SLEG_VAR(_num_nodes,                  SLE_UINT16),
 		 SLE_VAR(LinkGraph, cargo,            SLE_UINT8),
+		SLE_CONDVAR_X(LinkGraph, recalc_fingerprint, SLE_UINT64, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_LINKGRAPH_INCREMENTAL)),
+		SLE_CONDVAR_X(LinkGraph, recalc_skipped,     SLE_UINT8,  SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_LINKGRAPH_INCREMENTAL)),
 	};
 	return link_graph_desc;
 }
@@ -135,9 +137,11 @@ static const SaveLoad _edge_desc[] = {
 std::vector<SaveLoad> _filtered_node_desc;
 std::vector<SaveLoad> _filtered_edge_desc;
 std::vector<SaveLoad> _filtered_job_desc;
+std::vector<SaveLoad> _filtered_link_graph_desc;
 
 static void FilterDescs()
 {
+	_filtered_link_graph_desc = SlFilterObject(GetLinkGraphDesc());
 	_filtered_node_desc = SlFilterObject(_node_desc);
 	_filtered_edge_desc = SlFilterObject(_edge_desc);
 	_filtered_job_desc = SlFilterObject(GetLinkGraphJobDesc());
@@ -193,7 +197,7 @@ static void DoSave_LGRJ(LinkGraphJob *lgj)
 {
 	SlObjectSaveFiltered(lgj, _filtered_job_desc);
 	_num_nodes = lgj->Size();
-	SlObjectSaveFiltered(const_cast<LinkGraph *>(&lgj->Graph()), GetLinkGraphDesc()); // GetLinkGraphDesc has no conditionals
+	SlObjectSaveFiltered(const_cast<LinkGraph *>(&lgj->Graph()), _filtered_link_graph_desc);
 	Save_LinkGraph(const_cast<LinkGraph &>(lgj->Graph()));
 }
 
@@ -204,7 +208,7 @@ static void DoSave_LGRJ(LinkGraphJob *lgj)
 static void DoSave_LGRP(LinkGraph *lg)
 {
 	_num_nodes = lg->Size();
-	SlObjectSaveFiltered(lg, GetLinkGraphDesc()); // GetLinkGraphDesc has no conditionals
+	SlObjectSaveFiltered(lg, _filtered_link_graph_desc);
 	Save_LinkGraph(*lg);
 }
 
@@ -221,7 +225,7 @@ static void Load_LGRP()
 			NOT_REACHED();
 		}
 		LinkGraph *lg = new (index) LinkGraph();
-		SlObjectLoadFiltered(lg, GetLinkGraphDesc()); // GetLinkGraphDesc has no conditionals
+		SlObjectLoadFiltered(lg, _filtered_link_graph_desc);
 		lg->Init(_num_nodes);
 		Load_LinkGraph(*lg);
 	}
@@ -246,7 +250,7 @@ static void Load_LGRJ()
 			GetLinkGraphJobDayLengthScaleAfterLoad(lgj);
 		}
 		LinkGraph &lg = const_cast<LinkGraph &>(lgj->Graph());
-		SlObjectLoadFiltered(&lg, GetLinkGraphDesc()); // GetLinkGraphDesc has no conditionals
+		SlObjectLoadFiltered(&lg, _filtered_link_graph_desc);
 		lg.Init(_num_nodes);
 		Load_LinkGraph(lg);
 	}
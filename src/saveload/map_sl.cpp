@@ -55,17 +55,40 @@ static void Check_MAPS()
 
 static const uint MAP_SL_BUF_SIZE = 4096;
 
-static void Load_MAPT()
+template <typename T> T ReadMapFieldValue(const byte *src, size_t index);
+template <> inline uint8 ReadMapFieldValue<uint8>(const byte *src, size_t index) { return src[index]; }
+template <> inline uint16 ReadMapFieldValue<uint16>(const byte *src, size_t index) { return (src[index * 2] << 8) | src[(index * 2) + 1]; }
+
+/**
+ * Load one field of the tile arrays from a per-field map chunk.
+ * Values are stored straight from the read buffer into the tile arrays,
+ * one strided pass per buffer fill, instead of going through a staging buffer.
+ * @tparam T Type of the values in the savegame.
+ * @param store Store the value of a tile, called with the tile index and the value.
+ */
+template <typename T, typename F>
+static void LoadMapField(F store)
 {
-	std::array<byte, MAP_SL_BUF_SIZE> buf;
-	TileIndex size = MapSize();
+	ReadBuffer *reader = ReadBuffer::GetCurrent();
+	const TileIndex size = MapSize();
 
 	for (TileIndex i = 0; i != size;) {
-		SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT8);
-		for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _m[i++].type = buf[j];
+		reader->CheckBytes(sizeof(T));
+		const byte *src = reader->bufp;
+		const TileIndex count = std::min<TileIndex>(size - i, (TileIndex)((reader->bufe - src) / sizeof(T)));
+		for (TileIndex j = 0; j != count; j++) {
+			store(i + j, ReadMapFieldValue<T>(src, j));
+		}
+		reader->bufp += count * sizeof(T);
+		i += count;
 	}
 }
 
+static void Load_MAPT()
+{
+	LoadMapField<uint8>([](TileIndex t, uint8 v) { _m[t].type = v; });
+}
+
 static void Check_MAPH_common()
 {
 	if (_sl_maybe_chillpp && (SlGetFieldLength() == 0 || SlGetFieldLength() == _map_dim_x * _map_dim_y * 2)) {
@@ -87,82 +110,42 @@ static void Load_MAPH()
 	if (SlXvIsFeaturePresent(XSLFI_CHILLPP)) {
 		if (SlGetFieldLength() != 0) {
 			_sl_xv_feature_versions[XSLFI_HEIGHT_8_BIT] = 2;
-			std::array<uint16, MAP_SL_BUF_SIZE> buf;
-			TileIndex size = MapSize();
-
-			for (TileIndex i = 0; i != size;) {
-				SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT16);
-				for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _m[i++].height = buf[j];
-			}
+			LoadMapField<uint16>([](TileIndex t, uint16 v) { _m[t].height = (byte)v; });
 		}
 		return;
 	}
 
-	std::array<byte, MAP_SL_BUF_SIZE> buf;
-	TileIndex size = MapSize();
-
-	for (TileIndex i = 0; i != size;) {
-		SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT8);
-		for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _m[i++].height = buf[j];
-	}
+	LoadMapField<uint8>([](TileIndex t, uint8 v) { _m[t].height = v; });
 }
 
 static void Load_MAP1()
 {
-	std::array<byte, MAP_SL_BUF_SIZE> buf;
-	TileIndex size = MapSize();
-
-	for (TileIndex i = 0; i != size;) {
-		SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT8);
-		for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _m[i++].m1 = buf[j];
-	}
+	LoadMapField<uint8>([](TileIndex t, uint8 v) { _m[t].m1 = v; });
 }
 
 static void Load_MAP2()
 {
-	std::array<uint16, MAP_SL_BUF_SIZE> buf;
-	TileIndex size = MapSize();
-
-	for (TileIndex i = 0; i != size;) {
-		SlArray(buf.data(), MAP_SL_BUF_SIZE,
-			/* In those versions the m2 was 8 bits */
-			IsSavegameVersionBefore(SLV_5) ? SLE_FILE_U8 | SLE_VAR_U16 : SLE_UINT16
-		);
-		for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _m[i++].m2 = buf[j];
+	if (IsSavegameVersionBefore(SLV_5)) {
+		/* In those versions the m2 was 8 bits */
+		LoadMapField<uint8>([](TileIndex t, uint8 v) { _m[t].m2 = v; });
+	} else {
+		LoadMapField<uint16>([](TileIndex t, uint16 v) { _m[t].m2 = v; });
 	}
 }
 
 static void Load_MAP3()
 {
-	std::array<byte, MAP_SL_BUF_SIZE> buf;
-	TileIndex size = MapSize();
-
-	for (TileIndex i = 0; i != size;) {
-		SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT8);
-		for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _m[i++].m3 = buf[j];
-	}
+	LoadMapField<uint8>([](TileIndex t, uint8 v) { _m[t].m3 = v; });
 }
 
 static void Load_MAP4()
 {
-	std::array<byte, MAP_SL_BUF_SIZE> buf;
-	TileIndex size = MapSize();
-
-	for (TileIndex i = 0; i != size;) {
-		SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT8);
-		for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _m[i++].m4 = buf[j];
-	}
+	LoadMapField<uint8>([](TileIndex t, uint8 v) { _m[t].m4 = v; });
 }
 
 static void Load_MAP5()
 {
-	std::array<byte, MAP_SL_BUF_SIZE> buf;
-	TileIndex size = MapSize();
-
-	for (TileIndex i = 0; i != size;) {
-		SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT8);
-		for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _m[i++].m5 = buf[j];
-	}
+	LoadMapField<uint8>([](TileIndex t, uint8 v) { _m[t].m5 = v; });
 }
 
 static void Load_MAP6()
@@ -182,33 +165,18 @@ static void Load_MAP6()
 			}
 		}
 	} else {
-		for (TileIndex i = 0; i != size;) {
-			SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT8);
-			for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _me[i++].m6 = buf[j];
-		}
+		LoadMapField<uint8>([](TileIndex t, uint8 v) { _me[t].m6 = v; });
 	}
 }
 
 static void Load_MAP7()
 {
-	std::array<byte, MAP_SL_BUF_SIZE> buf;
-	TileIndex size = MapSize();
-
-	for (TileIndex i = 0; i != size;) {
-		SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT8);
-		for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _me[i++].m7 = buf[j];
-	}
+	LoadMapField<uint8>([](TileIndex t, uint8 v) { _me[t].m7 = v; });
 }
 
 static void Load_MAP8()
 {
-	std::array<uint16, MAP_SL_BUF_SIZE> buf;
-	TileIndex size = MapSize();
-
-	for (TileIndex i = 0; i != size;) {
-		SlArray(buf.data(), MAP_SL_BUF_SIZE, SLE_UINT16);
-		for (uint j = 0; j != MAP_SL_BUF_SIZE; j++) _me[i++].m8 = buf[j];
-	}
+	LoadMapField<uint16>([](TileIndex t, uint16 v) { _me[t].m8 = v; });
 }
 
 static void Load_WMAP()
@@ -308,7 +276,7 @@ static const ChunkHandler map_chunk_handlers[] = {
 	{ 'MAPE', nullptr,   Load_MAP6, nullptr, nullptr,    CH_RIFF },
 	{ 'MAP7', nullptr,   Load_MAP7, nullptr, nullptr,    CH_RIFF },
 	{ 'MAP8', nullptr,   Load_MAP8, nullptr, nullptr,    CH_RIFF },
-	{ 'WMAP', Save_WMAP, Load_WMAP, nullptr, nullptr,    CH_RIFF },
+	{ 'WMAP', Save_WMAP, Load_WMAP, nullptr, nullptr,    CH_RIFF, true },
 };
 
 extern const ChunkHandlerTable _map_chunk_handlers(map_chunk_handlers);
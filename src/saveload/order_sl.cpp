@@ -144,10 +144,11 @@ static std::vector<SaveLoad> _filtered_desc;
 
 static void Save_ORDR()
 {
-	_filtered_desc = SlFilterObject(GetOrderDescription());
+	/* Not _filtered_desc, this chunk may be saved concurrently with ORDX. */
+	const std::vector<SaveLoad> filtered_desc = SlFilterObject(GetOrderDescription());
 	for (Order *order : Order::Iterate()) {
 		SlSetArrayIndex(order->index);
-		SlObjectSaveFiltered(order, _filtered_desc);
+		SlObjectSaveFiltered(order, filtered_desc);
 	}
 }
 
@@ -406,8 +407,8 @@ static void Ptrs_BKOR()
 
 static const ChunkHandler order_chunk_handlers[] = {
 	{ 'BKOR', Save_BKOR, Load_BKOR, Ptrs_BKOR, nullptr, CH_ARRAY },
-	{ 'ORDR', Save_ORDR, Load_ORDR, Ptrs_ORDR, nullptr, CH_ARRAY },
-	{ 'ORDL', Save_ORDL, Load_ORDL, Ptrs_ORDL, nullptr, CH_ARRAY },
+	{ 'ORDR', Save_ORDR, Load_ORDR, Ptrs_ORDR, nullptr, CH_ARRAY, true },
+	{ 'ORDL', Save_ORDL, Load_ORDL, Ptrs_ORDL, nullptr, CH_ARRAY, true },
 	{ 'ORDX', Save_ORDX, Load_ORDX, nullptr,   nullptr, CH_SPARSE_ARRAY },
 };
 
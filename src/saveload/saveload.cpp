@@ -60,6 +60,9 @@
 #include "saveload_buffer.h"
 #include "extended_ver_sl.h"
 
+#include "../3rdparty/cpp-btree/btree_map.h"
+#include "../3rdparty/monocypher/monocypher.h"
+
 #include <deque>
 #include <vector>
 
@@ -70,6 +73,14 @@
 #include "../3rdparty/mingw-std-threads/mingw.mutex.h"
 #include "../3rdparty/mingw-std-threads/mingw.condition_variable.h"
 #endif
+/* Snapshot autosaves need fork(), which is not safe to use with the system frameworks on OSX. */
+#if defined(UNIX) && !defined(__APPLE__) && !defined(__EMSCRIPTEN__)
+#	define WITH_SNAPSHOT_AUTOSAVE
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/wait.h>
+#endif
 
 #include "../safeguards.h"
 
@@ -147,7 +158,7 @@ void ReadBuffer::AcquireBytes()
 void MemoryDumper::FinaliseBlock()
 {
 	assert(this->saved_buf == nullptr);
-	if (!this->blocks.empty()) {
+	if (this->bufe != nullptr) {
 		size_t s = MEMORY_CHUNK_SIZE - (this->bufe - this->buf);
 		this->blocks.back().size = s;
 		this->completed_block_bytes += s;
@@ -172,6 +183,25 @@ void MemoryDumper::AllocateBuffer()
 	this->bufe = this->buf + MEMORY_CHUNK_SIZE;
 }
 
+/**
+ * Move all data written to another dumper to the end of this one.
+ * The other dumper is left empty.
+ * @param other The dumper to take the data from.
+ */
+void MemoryDumper::Append(MemoryDumper &other)
+{
+	this->FinaliseBlock();
+	other.FinaliseBlock();
+
+	for (BufferInfo &block : other.blocks) {
+		this->blocks.emplace_back(std::move(block));
+	}
+	this->completed_block_bytes += other.completed_block_bytes;
+
+	other.blocks.clear();
+	other.completed_block_bytes = 0;
+}
+
 /**
  * Flush this dumper into a writer.
  * @param writer The filter we want to use.
@@ -243,16 +273,17 @@ struct SaveLoadParams {
 	SaveModeFlags save_flags;            ///< Save mode flags
 };
 
-static SaveLoadParams _sl; ///< Parameters used for/at saveload.
+static SaveLoadParams _sl_params;                           ///< Parameters used for/at saveload.
+static thread_local SaveLoadParams *_sl = &_sl_params;     ///< Parameters used by the current thread, chunks which are saved concurrently each use their own.
 
 ReadBuffer *ReadBuffer::GetCurrent()
 {
-	return _sl.reader;
+	return _sl->reader;
 }
 
 MemoryDumper *MemoryDumper::GetCurrent()
 {
-	return _sl.dumper;
+	return _sl->dumper;
 }
 
 static const std::vector<ChunkHandler> &ChunkHandlers()
@@ -370,7 +401,7 @@ static void SlNullPointers()
 		return;
 	}
 
-	_sl.action = SLA_NULL;
+	_sl->action = SLA_NULL;
 
 	/* We don't want any savegame conversion code to run
 	 * during NULLing; especially those that try to get
@@ -385,7 +416,7 @@ static void SlNullPointers()
 		}
 	}
 
-	assert(_sl.action == SLA_NULL);
+	assert(_sl->action == SLA_NULL);
 }
 
 struct ThreadSlErrorException {
@@ -408,26 +439,26 @@ void NORETURN SlError(StringID string, const char *extra_msg, bool already_mallo
 		str = already_malloced ? const_cast<char *>(extra_msg) : stredup(extra_msg);
 	}
 
-	if (IsNonMainThread() && IsNonGameThread() && _sl.action != SLA_SAVE) {
+	if (IsNonMainThread() && IsNonGameThread() && _sl->action != SLA_SAVE) {
 		throw ThreadSlErrorException{ string, extra_msg };
 	}
 
 	/* Distinguish between loading into _load_check_data vs. normal save/load. */
-	if (_sl.action == SLA_LOAD_CHECK) {
+	if (_sl->action == SLA_LOAD_CHECK) {
 		_load_check_data.error = string;
 		free(_load_check_data.error_data);
 		_load_check_data.error_data = str;
 	} else {
-		_sl.error_str = string;
-		free(_sl.extra_msg);
-		_sl.extra_msg = str;
+		_sl->error_str = string;
+		free(_sl->extra_msg);
+		_sl->extra_msg = str;
 	}
 
 	/* We have to nullptr all pointers here; we might be in a state where
 	 * the pointers are actually filled with indices, which means that
 	 * when we access them during cleaning the pool dereferences of
 	 * those indices will be made with segmentation faults as result. */
-	if (_sl.action == SLA_LOAD || _sl.action == SLA_PTRS) SlNullPointers();
+	if (_sl->action == SLA_LOAD || _sl->action == SLA_PTRS) SlNullPointers();
 
 	/* Logging could be active. */
 	GamelogStopAnyAction();
@@ -491,11 +522,103 @@ static void SetAsyncSaveFinish(AsyncSaveFinishProc proc)
 	_async_save_finish.store(proc, std::memory_order_release);
 }
 
+static bool _snapshot_save_process = false;                 ///< Whether this is the forked process writing a snapshot autosave.
+
+#if defined(WITH_SNAPSHOT_AUTOSAVE)
+static pid_t _snapshot_save_pid = -1;                       ///< Forked process writing a snapshot autosave, or -1 when there is none.
+static int _snapshot_save_pipe = -1;                        ///< Read end of the pipe over which the snapshot autosave process reports its result.
+
+/**
+ * Collect the result of a snapshot autosave, once its process has reported back.
+ * @param wait Whether to block until the process is done.
+ */
+static void ProcessSnapshotSave(bool wait)
+{
+	if (_snapshot_save_pid == -1) return;
+
+	if (wait) fcntl(_snapshot_save_pipe, F_SETFL, 0);
+
+	byte result = SL_ERROR;
+	ssize_t count;
+	do {
+		count = read(_snapshot_save_pipe, &result, 1);
+	} while (count == -1 && errno == EINTR);
+	if (count == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+
+	/* Either the result was received, or the pipe was closed without one because the process failed. */
+	close(_snapshot_save_pipe);
+	waitpid(_snapshot_save_pid, nullptr, 0);
+	_snapshot_save_pipe = -1;
+	_snapshot_save_pid = -1;
+
+	if (count != 1 || result != SL_OK) {
+		DEBUG(sl, 0, "Snapshot autosave failed");
+		ShowErrorMessage(STR_ERROR_AUTOSAVE_FAILED, INVALID_STRING_ID, WL_ERROR);
+	}
+}
+
+/**
+ * Write an autosave from a forked copy of the process.
+ * The child process has a copy-on-write view of the game state as it is at this tick, so it can
+ * serialise, compress and write the savegame while this process carries on with the game.
+ * @param filename The name of the autosave.
+ * @return Whether the child process was started; if not the autosave has to be made normally.
+ */
+static bool StartSnapshotSave(const char *filename)
+{
+	if (_snapshot_save_pid != -1) {
+		/* Still not done after a whole autosave interval, assume it is stuck. */
+		DEBUG(sl, 0, "Snapshot autosave process %d did not finish, terminating it", (int)_snapshot_save_pid);
+		kill(_snapshot_save_pid, SIGKILL);
+	}
+	WaitTillSaved();
+
+	int fds[2];
+#if defined(__linux__)
+	if (pipe2(fds, O_CLOEXEC) != 0) return false;
+#else
+	if (pipe(fds) != 0) return false;
+	fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+	fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+#endif
+
+	pid_t pid = fork();
+	if (pid == 0) {
+		/* Only the forking thread exists in the child. Locks held by other threads at the time of the fork are
+		 * never released in the child, so it must not start any threads (which takes the thread startup lock)
+		 * and must not touch the GUI; the chunks are saved serially and errors are reported by the parent.
+		 * A crash of the child must not write crash logs or emergency saves on behalf of the game either. */
+		_snapshot_save_process = true;
+		for (int signum : { SIGSEGV, SIGABRT, SIGFPE, SIGBUS, SIGILL }) signal(signum, SIG_DFL);
+		close(fds[0]);
+		byte result = SaveOrLoad(filename, SLO_SAVE, DFT_GAME_FILE, AUTOSAVE_DIR, false, SMF_ZSTD_OK);
+		if (write(fds[1], &result, 1) != 1) _exit(1);
+		_exit(0);
+	}
+
+	close(fds[1]);
+	if (pid == -1) {
+		DEBUG(sl, 1, "Cannot fork for snapshot autosave, reverting to normal autosave...");
+		close(fds[0]);
+		return false;
+	}
+
+	fcntl(fds[0], F_SETFL, O_NONBLOCK);
+	_snapshot_save_pid = pid;
+	_snapshot_save_pipe = fds[0];
+	return true;
+}
+#endif
+
 /**
  * Handle async save finishes.
  */
 void ProcessAsyncSaveFinish()
 {
+#if defined(WITH_SNAPSHOT_AUTOSAVE)
+	ProcessSnapshotSave(false);
+#endif
+
 	AsyncSaveFinishProc proc = _async_save_finish.exchange(nullptr, std::memory_order_acq_rel);
 	if (proc == nullptr) return;
 
@@ -512,7 +635,7 @@ void ProcessAsyncSaveFinish()
  */
 byte SlReadByte()
 {
-	return _sl.reader->ReadByte();
+	return _sl->reader->ReadByte();
 }
 
 /**
@@ -522,25 +645,25 @@ byte SlReadByte()
  */
 void SlSkipBytes(size_t length)
 {
-	return _sl.reader->SkipBytes(length);
+	return _sl->reader->SkipBytes(length);
 }
 
 int SlReadUint16()
 {
-	_sl.reader->CheckBytes(2);
-	return _sl.reader->RawReadUint16();
+	_sl->reader->CheckBytes(2);
+	return _sl->reader->RawReadUint16();
 }
 
 uint32 SlReadUint32()
 {
-	_sl.reader->CheckBytes(4);
-	return _sl.reader->RawReadUint32();
+	_sl->reader->CheckBytes(4);
+	return _sl->reader->RawReadUint32();
 }
 
 uint64 SlReadUint64()
 {
-	_sl.reader->CheckBytes(8);
-	return _sl.reader->RawReadUint64();
+	_sl->reader->CheckBytes(8);
+	return _sl->reader->RawReadUint64();
 }
 
 /**
@@ -549,25 +672,25 @@ uint64 SlReadUint64()
  */
 void SlWriteByte(byte b)
 {
-	_sl.dumper->WriteByte(b);
+	_sl->dumper->WriteByte(b);
 }
 
 void SlWriteUint16(uint16 v)
 {
-	_sl.dumper->CheckBytes(2);
-	_sl.dumper->RawWriteUint16(v);
+	_sl->dumper->CheckBytes(2);
+	_sl->dumper->RawWriteUint16(v);
 }
 
 void SlWriteUint32(uint32 v)
 {
-	_sl.dumper->CheckBytes(4);
-	_sl.dumper->RawWriteUint32(v);
+	_sl->dumper->CheckBytes(4);
+	_sl->dumper->RawWriteUint32(v);
 }
 
 void SlWriteUint64(uint64 v)
 {
-	_sl.dumper->CheckBytes(8);
-	_sl.dumper->RawWriteUint64(v);
+	_sl->dumper->CheckBytes(8);
+	_sl->dumper->RawWriteUint64(v);
 }
 
 /**
@@ -576,8 +699,8 @@ void SlWriteUint64(uint64 v)
  */
 size_t SlGetBytesRead()
 {
-	assert(_sl.action == SLA_LOAD || _sl.action == SLA_LOAD_CHECK);
-	return _sl.reader->GetSize();
+	assert(_sl->action == SLA_LOAD || _sl->action == SLA_LOAD_CHECK);
+	return _sl->reader->GetSize();
 }
 
 /**
@@ -586,8 +709,8 @@ size_t SlGetBytesRead()
  */
 size_t SlGetBytesWritten()
 {
-	assert(_sl.action == SLA_SAVE);
-	return _sl.dumper->GetSize();
+	assert(_sl->action == SLA_SAVE);
+	return _sl->dumper->GetSize();
 }
 
 /**
@@ -742,8 +865,8 @@ static inline size_t SlCalcRefLen()
 
 void SlSetArrayIndex(uint index)
 {
-	_sl.need_length = NL_WANTLENGTH;
-	_sl.array_index = index;
+	_sl->need_length = NL_WANTLENGTH;
+	_sl->array_index = index;
 }
 
 static size_t _next_offs;
@@ -758,8 +881,8 @@ int SlIterateArray()
 
 	/* After reading in the whole array inside the loop
 	 * we must have read in all the data, so we must be at end of current block. */
-	if (_next_offs != 0 && _sl.reader->GetSize() != _next_offs) {
-		DEBUG(sl, 1, "Invalid chunk size: " PRINTF_SIZE " != " PRINTF_SIZE, _sl.reader->GetSize(), _next_offs);
+	if (_next_offs != 0 && _sl->reader->GetSize() != _next_offs) {
+		DEBUG(sl, 1, "Invalid chunk size: " PRINTF_SIZE " != " PRINTF_SIZE, _sl->reader->GetSize(), _next_offs);
 		SlErrorCorrupt("Invalid chunk size");
 	}
 
@@ -770,12 +893,12 @@ int SlIterateArray()
 			return -1;
 		}
 
-		_sl.obj_len = --length;
-		_next_offs = _sl.reader->GetSize() + length;
+		_sl->obj_len = --length;
+		_next_offs = _sl->reader->GetSize() + length;
 
-		switch (_sl.block_mode) {
+		switch (_sl->block_mode) {
 			case CH_SPARSE_ARRAY: index = (int)SlReadSparseIndex(); break;
-			case CH_ARRAY:        index = _sl.array_index++; break;
+			case CH_ARRAY:        index = _sl->array_index++; break;
 			default:
 				DEBUG(sl, 0, "SlIterateArray error");
 				return -1; // error
@@ -791,7 +914,7 @@ int SlIterateArray()
 void SlSkipArray()
 {
 	while (SlIterateArray() != -1) {
-		SlSkipBytes(_next_offs - _sl.reader->GetSize());
+		SlSkipBytes(_next_offs - _sl->reader->GetSize());
 	}
 }
 
@@ -802,12 +925,12 @@ void SlSkipArray()
  */
 void SlSetLength(size_t length)
 {
-	assert(_sl.action == SLA_SAVE);
+	assert(_sl->action == SLA_SAVE);
 
-	switch (_sl.need_length) {
+	switch (_sl->need_length) {
 		case NL_WANTLENGTH:
-			_sl.need_length = NL_NONE;
-			switch (_sl.block_mode) {
+			_sl->need_length = NL_NONE;
+			switch (_sl->block_mode) {
 				case CH_RIFF:
 					/* Ugly encoding of >16M RIFF chunks
 					 * The lower 24 bits are normal
@@ -829,15 +952,15 @@ void SlSetLength(size_t length)
 					}
 					break;
 				case CH_ARRAY:
-					assert(_sl.last_array_index <= _sl.array_index);
-					while (++_sl.last_array_index <= _sl.array_index) {
+					assert(_sl->last_array_index <= _sl->array_index);
+					while (++_sl->last_array_index <= _sl->array_index) {
 						SlWriteArrayLength(1);
 					}
 					SlWriteArrayLength(length + 1);
 					break;
 				case CH_SPARSE_ARRAY:
-					SlWriteArrayLength(length + 1 + SlGetArrayLength(_sl.array_index)); // Also include length of sparse index.
-					SlWriteSparseIndex(_sl.array_index);
+					SlWriteArrayLength(length + 1 + SlGetArrayLength(_sl->array_index)); // Also include length of sparse index.
+					SlWriteSparseIndex(_sl->array_index);
 					break;
 				default: NOT_REACHED();
 			}
@@ -857,13 +980,13 @@ static void SlCopyBytes(void *ptr, size_t length)
 {
 	byte *p = (byte *)ptr;
 
-	switch (_sl.action) {
+	switch (_sl->action) {
 		case SLA_LOAD_CHECK:
 		case SLA_LOAD:
-			_sl.reader->CopyBytes(p, length);
+			_sl->reader->CopyBytes(p, length);
 			break;
 		case SLA_SAVE:
-			_sl.dumper->CopyBytes(p, length);
+			_sl->dumper->CopyBytes(p, length);
 			break;
 		default: NOT_REACHED();
 	}
@@ -872,7 +995,7 @@ static void SlCopyBytes(void *ptr, size_t length)
 /** Get the length of the current object */
 size_t SlGetFieldLength()
 {
-	return _sl.obj_len;
+	return _sl->obj_len;
 }
 
 /**
@@ -993,7 +1116,7 @@ static void SlSaveLoadConvGeneric(void *ptr, VarType conv)
 
 void SlSaveLoadConv(void *ptr, VarType conv)
 {
-	switch (_sl.action) {
+	switch (_sl->action) {
 		case SLA_SAVE:
 			SlSaveLoadConvGeneric<SLA_SAVE>(ptr, conv);
 			return;
@@ -1074,7 +1197,7 @@ static inline size_t SlCalcStringLen(const void *ptr, size_t length, VarType con
  */
 static void SlString(void *ptr, size_t length, VarType conv)
 {
-	switch (_sl.action) {
+	switch (_sl->action) {
 		case SLA_SAVE: {
 			size_t len;
 			switch (GetVarMemType(conv)) {
@@ -1153,7 +1276,7 @@ static void SlString(void *ptr, size_t length, VarType conv)
  */
 static void SlStdString(std::string &str, VarType conv)
 {
-	switch (_sl.action) {
+	switch (_sl->action) {
 		case SLA_SAVE: {
 			SlWriteArrayLength(str.size());
 			SlCopyBytes(str.data(), str.size());
@@ -1208,16 +1331,16 @@ static inline size_t SlCalcArrayLen(size_t length, VarType conv)
  */
 void SlArray(void *array, size_t length, VarType conv)
 {
-	if (_sl.action == SLA_PTRS || _sl.action == SLA_NULL) return;
+	if (_sl->action == SLA_PTRS || _sl->action == SLA_NULL) return;
 
 	/* Automatically calculate the length? */
-	if (_sl.need_length != NL_NONE) {
+	if (_sl->need_length != NL_NONE) {
 		SlSetLength(SlCalcArrayLen(length, conv));
 	}
 
 	/* NOTICE - handle some buggy stuff, in really old versions everything was saved
 	 * as a byte-type. So detect this, and adjust array size accordingly */
-	if (_sl.action != SLA_SAVE && _sl_version == 0) {
+	if (_sl->action != SLA_SAVE && _sl_version == 0) {
 		/* all arrays except difficulty settings */
 		if (conv == SLE_INT16 || conv == SLE_UINT16 || conv == SLE_STRINGID ||
 				conv == SLE_INT32 || conv == SLE_UINT32) {
@@ -1261,7 +1384,7 @@ void SlArray(void *array, size_t length, VarType conv)
  */
 static size_t ReferenceToInt(const void *obj, SLRefType rt)
 {
-	assert(_sl.action == SLA_SAVE);
+	assert(_sl->action == SLA_SAVE);
 
 	if (obj == nullptr) return 0;
 
@@ -1297,7 +1420,7 @@ static void *IntToReference(size_t index, SLRefType rt)
 {
 	static_assert(sizeof(size_t) <= sizeof(void *));
 
-	assert(_sl.action == SLA_PTRS);
+	assert(_sl->action == SLA_PTRS);
 
 	/* After version 4.3 REF_VEHICLE_OLD is saved as REF_VEHICLE,
 	 * and should be loaded like that */
@@ -1375,7 +1498,7 @@ static void *IntToReference(size_t index, SLRefType rt)
  */
 void SlSaveLoadRef(void *ptr, VarType conv)
 {
-	switch (_sl.action) {
+	switch (_sl->action) {
 		case SLA_SAVE:
 			SlWriteUint32((uint32)ReferenceToInt(*(void **)ptr, (SLRefType)conv));
 			break;
@@ -1439,7 +1562,7 @@ public:
 
 		SlStorageT *list = static_cast<SlStorageT *>(storage);
 
-		switch (_sl.action) {
+		switch (_sl->action) {
 			case SLA_SAVE:
 				SlWriteUint32((uint32)list->size());
 
@@ -1518,13 +1641,13 @@ template<typename PtrList>
 static void SlRefList(void *list, SLRefType conv)
 {
 	/* Automatically calculate the length? */
-	if (_sl.need_length != NL_NONE) {
+	if (_sl->need_length != NL_NONE) {
 		SlSetLength(SlCalcRefListLen<PtrList>(list));
 	}
 
 	PtrList *l = (PtrList *)list;
 
-	switch (_sl.action) {
+	switch (_sl->action) {
 		case SLA_SAVE: {
 			SlWriteUint32((uint32)l->size());
 
@@ -1574,13 +1697,13 @@ static void SlVarList(void *list, VarType conv)
 {
 	const size_t size_len = SlCalcConvMemLen(conv);
 	/* Automatically calculate the length? */
-	if (_sl.need_length != NL_NONE) {
+	if (_sl->need_length != NL_NONE) {
 		SlSetLength(SlCalcVarListLen<PtrList>(list, size_len));
 	}
 
 	PtrList *l = (PtrList *)list;
 
-	switch (_sl.action) {
+	switch (_sl->action) {
 		case SLA_SAVE: {
 			SlWriteUint32((uint32)l->size());
 
@@ -1679,7 +1802,7 @@ size_t SlCalcObjLength(const void *object, const SaveLoadTable &slt)
 
 size_t SlCalcObjMemberLength(const void *object, const SaveLoad &sld)
 {
-	assert(_sl.action == SLA_SAVE);
+	assert(_sl->action == SLA_SAVE);
 
 	switch (sld.cmd) {
 		case SL_VAR:
@@ -1794,7 +1917,7 @@ static void SlFilterObjectMember(const SaveLoad &sld, std::vector<SaveLoad> &sav
 			/* CONDITIONAL saveload types depend on the savegame version */
 			if (!SlIsObjectValidInSavegame(sld)) return;
 
-			switch (_sl.action) {
+			switch (_sl->action) {
 				case SLA_SAVE:
 				case SLA_LOAD_CHECK:
 				case SLA_LOAD:
@@ -1823,7 +1946,7 @@ static void SlFilterObjectMember(const SaveLoad &sld, std::vector<SaveLoad> &sav
 		 * When loading, the value is read explictly with SlReadByte() to determine which
 		 * object description to use. */
 		case SL_WRITEBYTE:
-			if (_sl.action == SLA_SAVE) save.push_back(sld);
+			if (_sl->action == SLA_SAVE) save.push_back(sld);
 			break;
 
 		/* SL_VEH_INCLUDE loads common code for vehicles */
@@ -1949,7 +2072,7 @@ bool SlObjectMemberGeneric(void *object, const SaveLoad &sld)
 
 bool SlObjectMember(void *object, const SaveLoad &sld)
 {
-	switch (_sl.action) {
+	switch (_sl->action) {
 		case SLA_SAVE:
 			return SlObjectMemberGeneric<SLA_SAVE, true>(object, sld);
 		case SLA_LOAD_CHECK:
@@ -1971,7 +2094,7 @@ bool SlObjectMember(void *object, const SaveLoad &sld)
 void SlObject(void *object, const SaveLoadTable &slt)
 {
 	/* Automatically calculate the length? */
-	if (_sl.need_length != NL_NONE) {
+	if (_sl->need_length != NL_NONE) {
 		SlSetLength(SlCalcObjLength(object, slt));
 	}
 
@@ -1990,14 +2113,14 @@ void SlObjectIterateBase(void *object, const SaveLoadTable &slt)
 
 void SlObjectSaveFiltered(void *object, const SaveLoadTable &slt)
 {
-	if (_sl.need_length != NL_NONE) {
-		_sl.need_length = NL_NONE;
-		_sl.dumper->StartAutoLength();
+	if (_sl->need_length != NL_NONE) {
+		_sl->need_length = NL_NONE;
+		_sl->dumper->StartAutoLength();
 		SlObjectIterateBase<SLA_SAVE, false>(object, slt);
-		auto result = _sl.dumper->StopAutoLength();
-		_sl.need_length = NL_WANTLENGTH;
+		auto result = _sl->dumper->StopAutoLength();
+		_sl->need_length = NL_WANTLENGTH;
 		SlSetLength(result.second);
-		_sl.dumper->CopyBytes(result.first, result.second);
+		_sl->dumper->CopyBytes(result.first, result.second);
 	} else {
 		SlObjectIterateBase<SLA_SAVE, false>(object, slt);
 	}
@@ -2010,7 +2133,7 @@ void SlObjectLoadFiltered(void *object, const SaveLoadTable &slt)
 
 void SlObjectPtrOrNullFiltered(void *object, const SaveLoadTable &slt)
 {
-	switch (_sl.action) {
+	switch (_sl->action) {
 		case SLA_PTRS:
 			SlObjectIterateBase<SLA_PTRS, false>(object, slt);
 			return;
@@ -2037,17 +2160,17 @@ void SlGlobList(const SaveLoadTable &slt)
  */
 void SlAutolength(AutolengthProc *proc, void *arg)
 {
-	assert(_sl.action == SLA_SAVE);
-	assert(_sl.need_length == NL_WANTLENGTH);
+	assert(_sl->action == SLA_SAVE);
+	assert(_sl->need_length == NL_WANTLENGTH);
 
-	_sl.need_length = NL_NONE;
-	_sl.dumper->StartAutoLength();
+	_sl->need_length = NL_NONE;
+	_sl->dumper->StartAutoLength();
 	proc(arg);
-	auto result = _sl.dumper->StopAutoLength();
+	auto result = _sl->dumper->StopAutoLength();
 	/* Setup length */
-	_sl.need_length = NL_WANTLENGTH;
+	_sl->need_length = NL_WANTLENGTH;
 	SlSetLength(result.second);
-	_sl.dumper->CopyBytes(result.first, result.second);
+	_sl->dumper->CopyBytes(result.first, result.second);
 }
 
 /**
@@ -2057,15 +2180,15 @@ void SlAutolength(AutolengthProc *proc, void *arg)
  */
 std::vector<byte> SlSaveToVector(AutolengthProc *proc, void *arg)
 {
-	assert(_sl.action == SLA_SAVE);
-	NeedLength orig_need_length = _sl.need_length;
+	assert(_sl->action == SLA_SAVE);
+	NeedLength orig_need_length = _sl->need_length;
 
-	_sl.need_length = NL_NONE;
-	_sl.dumper->StartAutoLength();
+	_sl->need_length = NL_NONE;
+	_sl->dumper->StartAutoLength();
 	proc(arg);
-	auto result = _sl.dumper->StopAutoLength();
+	auto result = _sl->dumper->StopAutoLength();
 	/* Setup length */
-	_sl.need_length = orig_need_length;
+	_sl->need_length = orig_need_length;
 	return std::vector<uint8>(result.first, result.first + result.second);
 }
 
@@ -2076,10 +2199,10 @@ std::vector<byte> SlSaveToVector(AutolengthProc *proc, void *arg)
  */
 void SlLoadFromBuffer(const byte *buffer, size_t length, AutolengthProc *proc, void *arg)
 {
-	assert(_sl.action == SLA_LOAD || _sl.action == SLA_LOAD_CHECK);
+	assert(_sl->action == SLA_LOAD || _sl->action == SLA_LOAD_CHECK);
 
-	size_t old_obj_len = _sl.obj_len;
-	_sl.obj_len = length;
+	size_t old_obj_len = _sl->obj_len;
+	_sl->obj_len = length;
 
 	ReadBuffer *reader = ReadBuffer::GetCurrent();
 	byte *old_bufp = reader->bufp;
@@ -2093,7 +2216,7 @@ void SlLoadFromBuffer(const byte *buffer, size_t length, AutolengthProc *proc, v
 		SlErrorCorrupt("SlLoadFromBuffer: Wrong number of bytes read");
 	}
 
-	_sl.obj_len = old_obj_len;
+	_sl->obj_len = old_obj_len;
 	reader->bufp = old_bufp;
 	reader->bufe = old_bufe;
 }
@@ -2133,8 +2256,8 @@ static void SlLoadChunk(const ChunkHandler &ch)
 	size_t len;
 	size_t endoffs;
 
-	_sl.block_mode = m;
-	_sl.obj_len = 0;
+	_sl->block_mode = m;
+	_sl->obj_len = 0;
 
 	SaveLoadChunkExtHeaderFlags ext_flags = static_cast<SaveLoadChunkExtHeaderFlags>(0);
 	if ((m & 0xF) == CH_EXT_HDR) {
@@ -2142,12 +2265,12 @@ static void SlLoadChunk(const ChunkHandler &ch)
 
 		/* read in real header */
 		m = SlReadByte();
-		_sl.block_mode = m;
+		_sl->block_mode = m;
 	}
 
 	switch (m) {
 		case CH_ARRAY:
-			_sl.array_index = 0;
+			_sl->array_index = 0;
 			ch.load_proc();
 			if (_next_offs != 0) SlErrorCorrupt("Invalid array length");
 			break;
@@ -2171,11 +2294,11 @@ static void SlLoadChunk(const ChunkHandler &ch)
 					len |= SlReadUint32() << 28;
 				}
 
-				_sl.obj_len = len;
-				endoffs = _sl.reader->GetSize() + len;
+				_sl->obj_len = len;
+				endoffs = _sl->reader->GetSize() + len;
 				ch.load_proc();
-				if (_sl.reader->GetSize() != endoffs) {
-					DEBUG(sl, 1, "Invalid chunk size: " PRINTF_SIZE " != " PRINTF_SIZE ", (" PRINTF_SIZE ")", _sl.reader->GetSize(), endoffs, len);
+				if (_sl->reader->GetSize() != endoffs) {
+					DEBUG(sl, 1, "Invalid chunk size: " PRINTF_SIZE " != " PRINTF_SIZE ", (" PRINTF_SIZE ")", _sl->reader->GetSize(), endoffs, len);
 					SlErrorCorrupt("Invalid chunk size");
 				}
 			} else {
@@ -2196,8 +2319,8 @@ static void SlLoadCheckChunk(const ChunkHandler *ch)
 	size_t len;
 	size_t endoffs;
 
-	_sl.block_mode = m;
-	_sl.obj_len = 0;
+	_sl->block_mode = m;
+	_sl->obj_len = 0;
 
 	SaveLoadChunkExtHeaderFlags ext_flags = static_cast<SaveLoadChunkExtHeaderFlags>(0);
 	if ((m & 0xF) == CH_EXT_HDR) {
@@ -2205,12 +2328,12 @@ static void SlLoadCheckChunk(const ChunkHandler *ch)
 
 		/* read in real header */
 		m = SlReadByte();
-		_sl.block_mode = m;
+		_sl->block_mode = m;
 	}
 
 	switch (m) {
 		case CH_ARRAY:
-			_sl.array_index = 0;
+			_sl->array_index = 0;
 			if (ext_flags) {
 				SlErrorCorruptFmt("CH_ARRAY does not take chunk header extension flags: 0x%X", ext_flags);
 			}
@@ -2253,15 +2376,15 @@ static void SlLoadCheckChunk(const ChunkHandler *ch)
 					}
 					len = static_cast<size_t>(full_len);
 				}
-				_sl.obj_len = len;
-				endoffs = _sl.reader->GetSize() + len;
+				_sl->obj_len = len;
+				endoffs = _sl->reader->GetSize() + len;
 				if (ch && ch->load_check_proc) {
 					ch->load_check_proc();
 				} else {
 					SlSkipBytes(len);
 				}
-				if (_sl.reader->GetSize() != endoffs) {
-					DEBUG(sl, 1, "Invalid chunk size: " PRINTF_SIZE " != " PRINTF_SIZE ", (" PRINTF_SIZE ")", _sl.reader->GetSize(), endoffs, len);
+				if (_sl->reader->GetSize() != endoffs) {
+					DEBUG(sl, 1, "Invalid chunk size: " PRINTF_SIZE " != " PRINTF_SIZE ", (" PRINTF_SIZE ")", _sl->reader->GetSize(), endoffs, len);
 					SlErrorCorrupt("Invalid chunk size");
 				}
 			} else {
@@ -2289,14 +2412,14 @@ static void SlSaveChunk(const ChunkHandler &ch)
 	size_t written = 0;
 	if (_debug_sl_level >= 3) written = SlGetBytesWritten();
 
-	_sl.block_mode = ch.type;
+	_sl->block_mode = ch.type;
 	switch (ch.type) {
 		case CH_RIFF:
-			_sl.need_length = NL_WANTLENGTH;
+			_sl->need_length = NL_WANTLENGTH;
 			proc();
 			break;
 		case CH_ARRAY:
-			_sl.last_array_index = 0;
+			_sl->last_array_index = 0;
 			SlWriteByte(CH_ARRAY);
 			proc();
 			SlWriteArrayLength(0); // Terminate arrays
@@ -2312,15 +2435,138 @@ static void SlSaveChunk(const ChunkHandler &ch)
 	DEBUG(sl, 3, "Saved chunk %c%c%c%c (" PRINTF_SIZE " bytes)", ch.id >> 24, ch.id >> 16, ch.id >> 8, ch.id, SlGetBytesWritten() - written);
 }
 
-/** Save all chunks */
+/** A chunk which is saved concurrently with the other chunks, into its own dumper. */
+struct ConcurrentChunkSave {
+	const ChunkHandler &ch;              ///< The chunk to save.
+	SaveLoadParams params;               ///< Saveload parameters of the thread saving the chunk.
+	MemoryDumper dumper;                 ///< Memory dumper the chunk is written to.
+	bool error = false;                  ///< Whether saving the chunk failed.
+
+	ConcurrentChunkSave(const ChunkHandler &ch) : ch(ch), params(*_sl)
+	{
+		this->params.dumper = &this->dumper;
+		this->params.sf = nullptr;
+		this->params.extra_msg = nullptr;
+	}
+
+	~ConcurrentChunkSave()
+	{
+		free(this->params.extra_msg);
+	}
+
+	void Run()
+	{
+		SaveLoadParams *prev = _sl;
+		_sl = &this->params;
+		try {
+			SlSaveChunk(this->ch);
+		} catch (...) {
+			this->error = true;
+		}
+		_sl = prev;
+	}
+};
+
+/** Location of a chunk in the uncompressed savegame. */
+struct SavedChunkRange {
+	uint32 id;                           ///< ID of the chunk.
+	size_t offset;                       ///< Offset of the chunk from the start of the savegame data.
+	size_t length;                       ///< Length of the chunk.
+};
+
+static std::vector<SavedChunkRange> _saved_chunk_ranges; ///< Location of the chunks of the last savegame written by SlSaveChunks.
+
+/**
+ * Save all chunks.
+ * Chunks marked with ChunkHandler::concurrent_save are saved by worker threads, each into its own dumper,
+ * while the other chunks are saved on this thread. The results are then joined in the usual chunk order,
+ * so the output is identical to saving all chunks one after another.
+ */
 static void SlSaveChunks()
 {
+	std::vector<std::unique_ptr<ConcurrentChunkSave>> jobs;
 	for (auto &ch : ChunkHandlers()) {
-		SlSaveChunk(ch);
+		if (ch.concurrent_save && ch.save_proc != nullptr) jobs.emplace_back(new ConcurrentChunkSave(ch));
 	}
 
-	/* Terminator */
-	SlWriteUint32(0);
+	std::atomic<size_t> next_job(0);
+	auto run_jobs = [&]() {
+		for (size_t i = next_job.fetch_add(1); i < jobs.size(); i = next_job.fetch_add(1)) {
+			jobs[i]->Run();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	const size_t num_threads = _snapshot_save_process ? 0 : std::min<size_t>(std::max<uint>(std::thread::hardware_concurrency(), 1) - 1, jobs.size());
+	for (size_t i = 0; i < num_threads; i++) {
+		std::thread t;
+		if (!StartNewThread(&t, "ottd:savechunk", [&]() { run_jobs(); })) break;
+		threads.push_back(std::move(t));
+	}
+
+	/* Meanwhile save the other chunks, starting a new dumper after each chunk which is saved elsewhere. */
+	MemoryDumper *main_dumper = _sl->dumper;
+	std::vector<std::unique_ptr<MemoryDumper>> segments;
+	std::vector<MemoryDumper *> order;
+	std::vector<std::pair<MemoryDumper *, SavedChunkRange>> ranges; ///< Chunk locations, relative to the dumper they are in.
+	try {
+		size_t job = 0;
+		for (auto &ch : ChunkHandlers()) {
+			if (ch.concurrent_save && ch.save_proc != nullptr) {
+				ranges.push_back({ &jobs[job]->dumper, { ch.id, 0, 0 } });
+				order.push_back(&jobs[job++]->dumper);
+				segments.emplace_back(new MemoryDumper());
+				_sl->dumper = segments.back().get();
+				order.push_back(_sl->dumper);
+			} else if (ch.save_proc != nullptr) {
+				size_t offset = _sl->dumper->GetSize();
+				SlSaveChunk(ch);
+				ranges.push_back({ _sl->dumper, { ch.id, offset, _sl->dumper->GetSize() - offset } });
+			}
+		}
+
+		/* Terminator */
+		SlWriteUint32(0);
+	} catch (...) {
+		next_job.store(jobs.size());
+		for (std::thread &t : threads) t.join();
+		_sl->dumper = main_dumper;
+		throw;
+	}
+
+	/* Help with any chunks which are not started yet, when all are done the threads can be joined. */
+	run_jobs();
+	for (std::thread &t : threads) t.join();
+	_sl->dumper = main_dumper;
+
+	for (auto &job : jobs) {
+		if (job->error) {
+			_sl->error_str = job->params.error_str;
+			free(_sl->extra_msg);
+			_sl->extra_msg = job->params.extra_msg;
+			job->params.extra_msg = nullptr;
+			throw std::exception();
+		}
+	}
+
+	/* Chunks saved concurrently make up the whole of their dumper. */
+	for (auto &it : ranges) {
+		if (it.second.length == 0) it.second.length = it.first->GetSize();
+	}
+
+	_saved_chunk_ranges.clear();
+	size_t offset = main_dumper->GetSize();
+	auto range = ranges.begin();
+	for (; range != ranges.end() && range->first == main_dumper; ++range) {
+		_saved_chunk_ranges.push_back(range->second);
+	}
+	for (MemoryDumper *dumper : order) {
+		for (; range != ranges.end() && range->first == dumper; ++range) {
+			_saved_chunk_ranges.push_back({ range->second.id, offset + range->second.offset, range->second.length });
+		}
+		offset += dumper->GetSize();
+		main_dumper->Append(*dumper);
+	}
 }
 
 /**
@@ -2398,7 +2644,7 @@ static void SlFixPointers()
 		return;
 	}
 
-	_sl.action = SLA_PTRS;
+	_sl->action = SLA_PTRS;
 
 	for (auto &ch : ChunkHandlers()) {
 		if (ch.ptrs_proc != nullptr) {
@@ -2407,7 +2653,7 @@ static void SlFixPointers()
 		}
 	}
 
-	assert(_sl.action == SLA_PTRS);
+	assert(_sl->action == SLA_PTRS);
 }
 
 
@@ -2431,7 +2677,7 @@ struct FileReader : LoadFilter {
 		this->file = nullptr;
 
 		/* Make sure we don't double free. */
-		_sl.sf = nullptr;
+		_sl->sf = nullptr;
 	}
 
 	size_t Read(byte *buf, size_t size) override
@@ -2469,7 +2715,7 @@ struct FileWriter : SaveFilter {
 		this->Finish();
 
 		/* Make sure we don't double free. */
-		_sl.sf = nullptr;
+		_sl->sf = nullptr;
 	}
 
 	void Write(byte *buf, size_t size) override
@@ -3106,19 +3352,19 @@ static void ResetSaveloadData()
  */
 static inline void ClearSaveLoadState()
 {
-	delete _sl.dumper;
-	_sl.dumper = nullptr;
+	delete _sl->dumper;
+	_sl->dumper = nullptr;
 
-	delete _sl.sf;
-	_sl.sf = nullptr;
+	delete _sl->sf;
+	_sl->sf = nullptr;
 
-	delete _sl.reader;
-	_sl.reader = nullptr;
+	delete _sl->reader;
+	_sl->reader = nullptr;
 
-	delete _sl.lf;
-	_sl.lf = nullptr;
+	delete _sl->lf;
+	_sl->lf = nullptr;
 
-	_sl.save_flags = SMF_NONE;
+	_sl->save_flags = SMF_NONE;
 
 	GamelogStopAnyAction();
 }
@@ -3130,22 +3376,32 @@ static inline void ClearSaveLoadState()
  */
 static void SaveFileStart()
 {
-	_sl.game_speed = _game_speed;
+	if (_snapshot_save_process) {
+		_sl->saveinprogress = true;
+		return;
+	}
+
+	_sl->game_speed = _game_speed;
 	_game_speed = 100;
 	SetMouseCursorBusy(true);
 
 	InvalidateWindowData(WC_STATUS_BAR, 0, SBI_SAVELOAD_START);
-	_sl.saveinprogress = true;
+	_sl->saveinprogress = true;
 }
 
 /** Update the gui accordingly when saving is done and release locks on saveload. */
 static void SaveFileDone()
 {
-	if (_game_mode != GM_MENU) _game_speed = _sl.game_speed;
+	if (_snapshot_save_process) {
+		_sl->saveinprogress = false;
+		return;
+	}
+
+	if (_game_mode != GM_MENU) _game_speed = _sl->game_speed;
 	SetMouseCursorBusy(false);
 
 	InvalidateWindowData(WC_STATUS_BAR, 0, SBI_SAVELOAD_FINISH);
-	_sl.saveinprogress = false;
+	_sl->saveinprogress = false;
 
 #ifdef __EMSCRIPTEN__
 	EM_ASM(if (window["openttd_syncfs"]) openttd_syncfs());
@@ -3155,28 +3411,266 @@ static void SaveFileDone()
 /** Set the error message from outside of the actual loading/saving of the game (AfterLoadGame and friends) */
 void SetSaveLoadError(StringID str)
 {
-	_sl.error_str = str;
+	_sl->error_str = str;
 }
 
 /** Get the string representation of the error message */
 const char *GetSaveLoadErrorString()
 {
-	SetDParam(0, _sl.error_str);
-	SetDParamStr(1, _sl.extra_msg);
+	SetDParam(0, _sl->error_str);
+	SetDParamStr(1, _sl->extra_msg);
 
 	static char err_str[512];
-	GetString(err_str, _sl.action == SLA_SAVE ? STR_ERROR_GAME_SAVE_FAILED : STR_ERROR_GAME_LOAD_FAILED, lastof(err_str));
+	GetString(err_str, _sl->action == SLA_SAVE ? STR_ERROR_GAME_SAVE_FAILED : STR_ERROR_GAME_LOAD_FAILED, lastof(err_str));
 	return err_str;
 }
 
 /** Show a gui message when saving has failed */
 static void SaveFileError()
 {
+	if (_snapshot_save_process) {
+		SaveFileDone();
+		return;
+	}
+
 	SetDParamStr(0, GetSaveLoadErrorString());
 	ShowErrorMessage(STR_JUST_RAW_STRING, INVALID_STRING_ID, WL_ERROR);
 	SaveFileDone();
 }
 
+static const uint32 DELTA_SAVE_TAG = TO_BE32X('OTDL'); ///< Tag at the start of a delta autosave, followed by the tag of its compression format.
+static const uint32 DELTA_SAVE_VERSION = 1;            ///< Version of the delta autosave format.
+static const size_t DELTA_SAVE_BLOCK_SIZE = 64 * 1024; ///< Size of the blocks in which chunks are compared against the base of a delta autosave.
+
+/** Operations of a delta autosave, which make up the savegame from its base. */
+enum DeltaSaveOperation : byte {
+	DSO_END    = 0, ///< End of the delta.
+	DSO_COPY   = 1, ///< Copy a range of the base savegame, followed by its offset and length.
+	DSO_INSERT = 2, ///< Insert data, followed by its length and the data.
+};
+
+/** Layout of a savegame, as needed to write delta autosaves against it. */
+struct DeltaSaveLayout {
+	/** A chunk of the savegame. */
+	struct Chunk {
+		uint32 id;                              ///< ID of the chunk.
+		size_t offset;                          ///< Offset of the chunk from the start of the savegame data.
+		size_t length;                          ///< Length of the chunk.
+		std::vector<uint64> block_hashes;       ///< Hash of each #DELTA_SAVE_BLOCK_SIZE block of the chunk.
+	};
+
+	std::string filename;                       ///< Name of the savegame, in the autosave directory.
+	size_t size = 0;                            ///< Size of the uncompressed savegame data.
+	uint64 hash = 0;                            ///< Hash of the whole uncompressed savegame data.
+	std::vector<Chunk> chunks;                  ///< The chunks, in order.
+};
+
+static DeltaSaveLayout _delta_save_base;       ///< Layout of the last full autosave, which delta autosaves refer to.
+static std::string _delta_save_filename;       ///< Name of the #SMF_DELTA_BASE autosave being written.
+static uint _delta_autosave_count = 0;         ///< Number of delta autosaves written since the last full autosave.
+
+/**
+ * Forget the full autosave which delta autosaves refer to, so that the next autosave is a full one.
+ * This has to be done when a different game is started or loaded.
+ */
+void ResetDeltaAutosaveBase()
+{
+	WaitTillSaved();
+	_delta_save_base = DeltaSaveLayout();
+	_delta_save_filename.clear();
+	_delta_autosave_count = 0;
+}
+
+/** Sequential reader over the data written to a MemoryDumper. */
+struct MemoryDumperReader {
+	const MemoryDumper &dumper;                 ///< The dumper to read.
+	size_t block = 0;                           ///< Current block of the dumper.
+	size_t pos = 0;                             ///< Position in the current block.
+
+	MemoryDumperReader(const MemoryDumper &dumper) : dumper(dumper) {}
+
+	/**
+	 * Read the next bytes.
+	 * @param length Number of bytes to read.
+	 * @param proc Function called with the data and size of each part of the bytes which is contiguous in memory.
+	 */
+	template <typename F>
+	void Read(size_t length, F proc)
+	{
+		while (length > 0) {
+			const MemoryDumper::BufferInfo &info = this->dumper.blocks[this->block];
+			size_t count = std::min(length, info.size - this->pos);
+			proc(info.data + this->pos, count);
+			length -= count;
+			this->pos += count;
+			if (this->pos == info.size) {
+				this->block++;
+				this->pos = 0;
+			}
+		}
+	}
+};
+
+/**
+ * Start a hash as used by delta autosaves.
+ * @param ctx The hash context to initialise.
+ */
+static void InitDeltaSaveHash(crypto_blake2b_ctx *ctx)
+{
+	crypto_blake2b_general_init(ctx, 8, nullptr, 0);
+}
+
+/**
+ * Finish a hash as used by delta autosaves.
+ * @param ctx The hash context.
+ * @return The hash.
+ */
+static uint64 FinishDeltaSaveHash(crypto_blake2b_ctx *ctx)
+{
+	uint8 digest[8];
+	crypto_blake2b_final(ctx, digest);
+
+	uint64 hash = 0;
+	for (uint i = 0; i < lengthof(digest); i++) {
+		hash |= (uint64)digest[i] << (i * 8);
+	}
+	return hash;
+}
+
+/**
+ * Get the layout of the savegame in a dumper, as last written by SlSaveChunks.
+ * @param dumper The dumper holding the savegame.
+ * @param layout The layout to fill.
+ */
+static void GetDeltaSaveLayout(const MemoryDumper &dumper, DeltaSaveLayout &layout)
+{
+	MemoryDumperReader reader(dumper);
+	crypto_blake2b_ctx whole;
+	InitDeltaSaveHash(&whole);
+
+	auto hash_data = [&](size_t length) -> uint64 {
+		crypto_blake2b_ctx ctx;
+		InitDeltaSaveHash(&ctx);
+		reader.Read(length, [&](const byte *data, size_t size) {
+			crypto_blake2b_update(&ctx, data, size);
+			crypto_blake2b_update(&whole, data, size);
+		});
+		return FinishDeltaSaveHash(&ctx);
+	};
+
+	layout.size = dumper.GetSize();
+	layout.chunks.clear();
+
+	size_t offset = 0;
+	for (const SavedChunkRange &range : _saved_chunk_ranges) {
+		assert(range.offset >= offset);
+		hash_data(range.offset - offset);
+
+		DeltaSaveLayout::Chunk chunk{ range.id, range.offset, range.length, {} };
+		chunk.block_hashes.reserve(CeilDivT<size_t>(range.length, DELTA_SAVE_BLOCK_SIZE));
+		for (size_t done = 0; done < range.length; done += DELTA_SAVE_BLOCK_SIZE) {
+			chunk.block_hashes.push_back(hash_data(std::min(DELTA_SAVE_BLOCK_SIZE, range.length - done)));
+		}
+		layout.chunks.push_back(std::move(chunk));
+		offset = range.offset + range.length;
+	}
+	hash_data(layout.size - offset);
+
+	layout.hash = FinishDeltaSaveHash(&whole);
+}
+
+/**
+ * Write a delta autosave, which makes up a savegame from the parts of a base savegame which are still the same, and the changed data.
+ * Chunks are compared block by block to the chunk with the same ID in the base savegame, so when a chunk keeps its size
+ * (like the map chunks) only the changed blocks are written, otherwise only the blocks before the first change are reused.
+ * @param dumper The dumper holding the savegame.
+ * @param layout The layout of the savegame.
+ * @param base The layout of the base savegame.
+ * @param delta The dumper to write the delta to.
+ */
+static void WriteDeltaSave(const MemoryDumper &dumper, const DeltaSaveLayout &layout, const DeltaSaveLayout &base, MemoryDumper &delta)
+{
+	delta.CheckBytes(4 + 2 + base.filename.size() + 4 * 8);
+	delta.RawWriteUint32(DELTA_SAVE_VERSION);
+	delta.RawWriteUint16((uint16)base.filename.size());
+	for (char c : base.filename) delta.RawWriteByte((byte)c);
+	delta.RawWriteUint64(base.size);
+	delta.RawWriteUint64(base.hash);
+	delta.RawWriteUint64(layout.size);
+	delta.RawWriteUint64(layout.hash);
+
+	btree::btree_map<uint32, const DeltaSaveLayout::Chunk *> base_chunks;
+	for (const DeltaSaveLayout::Chunk &chunk : base.chunks) {
+		base_chunks[chunk.id] = &chunk;
+	}
+
+	/* Adjacent operations of the same kind are merged, the data of insertions is taken from the reader when they are written. */
+	MemoryDumperReader reader(dumper);
+	DeltaSaveOperation pending = DSO_END;
+	size_t pending_offset = 0;
+	size_t pending_length = 0;
+	size_t inserted = 0;
+
+	auto flush = [&]() {
+		if (pending == DSO_COPY) {
+			delta.CheckBytes(1 + 8 + 8);
+			delta.RawWriteByte(DSO_COPY);
+			delta.RawWriteUint64(pending_offset);
+			delta.RawWriteUint64(pending_length);
+		} else if (pending == DSO_INSERT) {
+			delta.CheckBytes(1 + 8);
+			delta.RawWriteByte(DSO_INSERT);
+			delta.RawWriteUint64(pending_length);
+			reader.Read(pending_length, [&](const byte *data, size_t size) {
+				delta.CopyBytes(data, size);
+			});
+			inserted += pending_length;
+		}
+		pending = DSO_END;
+		pending_length = 0;
+	};
+	auto copy = [&](size_t offset, size_t length) {
+		if (pending != DSO_COPY || pending_offset + pending_length != offset) {
+			flush();
+			pending = DSO_COPY;
+			pending_offset = offset;
+		}
+		pending_length += length;
+		reader.Read(length, [](const byte *data, size_t size) {});
+	};
+	auto insert = [&](size_t length) {
+		if (pending != DSO_INSERT) flush();
+		pending = DSO_INSERT;
+		pending_length += length;
+	};
+
+	size_t offset = 0;
+	for (const DeltaSaveLayout::Chunk &chunk : layout.chunks) {
+		if (chunk.offset > offset) insert(chunk.offset - offset);
+
+		auto it = base_chunks.find(chunk.id);
+		const DeltaSaveLayout::Chunk *base_chunk = (it != base_chunks.end()) ? it->second : nullptr;
+		for (size_t i = 0; i < chunk.block_hashes.size(); i++) {
+			size_t start = i * DELTA_SAVE_BLOCK_SIZE;
+			size_t length = std::min(DELTA_SAVE_BLOCK_SIZE, chunk.length - start);
+			if (base_chunk != nullptr && i < base_chunk->block_hashes.size() && base_chunk->block_hashes[i] == chunk.block_hashes[i] &&
+					std::min(DELTA_SAVE_BLOCK_SIZE, base_chunk->length - start) == length) {
+				copy(base_chunk->offset + start, length);
+			} else {
+				insert(length);
+			}
+		}
+		offset = chunk.offset + chunk.length;
+	}
+	if (layout.size > offset) insert(layout.size - offset);
+	flush();
+
+	delta.CheckBytes(1);
+	delta.RawWriteByte(DSO_END);
+
+	DEBUG(sl, 1, "Delta autosave against '%s': " PRINTF_SIZE " of " PRINTF_SIZE " bytes changed", base.filename.c_str(), inserted, layout.size);
+}
+
 /**
  * We have written the whole game into memory, _memory_savegame, now find
  * and appropriate compressor and start writing to file.
@@ -3185,19 +3679,36 @@ static SaveOrLoadResult SaveFileToDisk(bool threaded)
 {
 	try {
 		byte compression;
-		const SaveLoadFormat *fmt = GetSavegameFormat(_savegame_format, &compression, _sl.save_flags);
+		const SaveLoadFormat *fmt = GetSavegameFormat(_savegame_format, &compression, _sl->save_flags);
 
 		DEBUG(sl, 3, "Using compression format: %s, level: %u", fmt->name, compression);
 
 		/* We have written our stuff to memory, now write it to file! */
 		uint32 hdr[2] = { fmt->tag, TO_BE32((uint32) (SAVEGAME_VERSION | SAVEGAME_VERSION_EXT) << 16) };
-		_sl.sf->Write((byte*)hdr, sizeof(hdr));
 
-		_sl.sf = fmt->init_write(_sl.sf, compression);
-		_sl.dumper->Flush(_sl.sf);
+		const SaveModeFlags save_flags = _sl->save_flags;
+		DeltaSaveLayout layout;
+		std::unique_ptr<MemoryDumper> delta;
+		if (save_flags & (SMF_DELTA_BASE | SMF_DELTA)) GetDeltaSaveLayout(*_sl->dumper, layout);
+		if (save_flags & SMF_DELTA) {
+			delta.reset(new MemoryDumper());
+			WriteDeltaSave(*_sl->dumper, layout, _delta_save_base, *delta);
+			hdr[0] = DELTA_SAVE_TAG;
+			hdr[1] = fmt->tag;
+		}
+
+		_sl->sf->Write((byte*)hdr, sizeof(hdr));
+
+		_sl->sf = fmt->init_write(_sl->sf, compression);
+		(delta != nullptr ? delta.get() : _sl->dumper)->Flush(_sl->sf);
 
 		ClearSaveLoadState();
 
+		if (save_flags & SMF_DELTA_BASE) {
+			layout.filename = _delta_save_filename;
+			_delta_save_base = std::move(layout);
+		}
+
 		if (threaded) SetAsyncSaveFinish(SaveFileDone);
 
 		return SL_OK;
@@ -3208,7 +3719,7 @@ static SaveOrLoadResult SaveFileToDisk(bool threaded)
 
 		/* We don't want to shout when saving is just
 		 * cancelled due to a client disconnecting. */
-		if (_sl.error_str != STR_NETWORK_ERROR_LOSTCONNECTION) {
+		if (_sl->error_str != STR_NETWORK_ERROR_LOSTCONNECTION) {
 			/* Skip the "colour" character */
 			DEBUG(sl, 0, "%s", GetSaveLoadErrorString() + 3);
 			asfp = SaveFileError;
@@ -3225,6 +3736,10 @@ static SaveOrLoadResult SaveFileToDisk(bool threaded)
 
 void WaitTillSaved()
 {
+#if defined(WITH_SNAPSHOT_AUTOSAVE)
+	ProcessSnapshotSave(true);
+#endif
+
 	if (!_save_thread.joinable()) return;
 
 	_save_thread.join();
@@ -3243,10 +3758,10 @@ void WaitTillSaved()
  */
 static SaveOrLoadResult DoSave(SaveFilter *writer, bool threaded)
 {
-	assert(!_sl.saveinprogress);
+	assert(!_sl->saveinprogress);
 
-	_sl.dumper = new MemoryDumper();
-	_sl.sf = writer;
+	_sl->dumper = new MemoryDumper();
+	_sl->sf = writer;
 
 	_sl_version = SAVEGAME_VERSION;
 	SlXvSetCurrentState();
@@ -3278,8 +3793,8 @@ static SaveOrLoadResult DoSave(SaveFilter *writer, bool threaded)
 SaveOrLoadResult SaveWithFilter(SaveFilter *writer, bool threaded, SaveModeFlags flags)
 {
 	try {
-		_sl.action = SLA_SAVE;
-		_sl.save_flags = flags;
+		_sl->action = SLA_SAVE;
+		_sl->save_flags = flags;
 		return DoSave(writer, threaded);
 	} catch (...) {
 		ClearSaveLoadState();
@@ -3289,7 +3804,7 @@ SaveOrLoadResult SaveWithFilter(SaveFilter *writer, bool threaded, SaveModeFlags
 
 bool IsNetworkServerSave()
 {
-	return _sl.save_flags & SMF_NET_SERVER;
+	return _sl->save_flags & SMF_NET_SERVER;
 }
 
 struct ThreadedLoadFilter : LoadFilter {
@@ -3406,7 +3921,7 @@ struct ThreadedLoadFilter : LoadFilter {
  */
 static SaveOrLoadResult DoLoad(LoadFilter *reader, bool load_check)
 {
-	_sl.lf = reader;
+	_sl->lf = reader;
 
 	if (load_check) {
 		/* Clear previous check data */
@@ -3422,7 +3937,7 @@ static SaveOrLoadResult DoLoad(LoadFilter *reader, bool load_check)
 	});
 
 	uint32 hdr[2];
-	if (_sl.lf->Read((byte*)hdr, sizeof(hdr)) != sizeof(hdr)) SlError(STR_GAME_SAVELOAD_ERROR_FILE_NOT_READABLE);
+	if (_sl->lf->Read((byte*)hdr, sizeof(hdr)) != sizeof(hdr)) SlError(STR_GAME_SAVELOAD_ERROR_FILE_NOT_READABLE);
 
 	/* see if we have any loader for this type. */
 	const SaveLoadFormat *fmt = _saveload_formats;
@@ -3430,7 +3945,7 @@ static SaveOrLoadResult DoLoad(LoadFilter *reader, bool load_check)
 		/* No loader found, treat as version 0 and use LZO format */
 		if (fmt == endof(_saveload_formats)) {
 			DEBUG(sl, 0, "Unknown savegame type, trying to load it as the buggy format");
-			_sl.lf->Reset();
+			_sl->lf->Reset();
 			_sl_version = SL_MIN_VERSION;
 			_sl_minor_version = 0;
 			SlXvResetState();
@@ -3492,11 +4007,11 @@ static SaveOrLoadResult DoLoad(LoadFilter *reader, bool load_check)
 		SlError(STR_GAME_SAVELOAD_ERROR_BROKEN_INTERNAL_ERROR, err_str);
 	}
 
-	_sl.lf = fmt->init_load(_sl.lf);
+	_sl->lf = fmt->init_load(_sl->lf);
 	if (!(fmt->flags & SLF_NO_THREADED_LOAD)) {
-		_sl.lf = new ThreadedLoadFilter(_sl.lf);
+		_sl->lf = new ThreadedLoadFilter(_sl->lf);
 	}
-	_sl.reader = new ReadBuffer(_sl.lf);
+	_sl->reader = new ReadBuffer(_sl->lf);
 	_next_offs = 0;
 
 	if (!load_check) {
@@ -3577,7 +4092,7 @@ static SaveOrLoadResult DoLoad(LoadFilter *reader, bool load_check)
 SaveOrLoadResult LoadWithFilter(LoadFilter *reader)
 {
 	try {
-		_sl.action = SLA_LOAD;
+		_sl->action = SLA_LOAD;
 		return DoLoad(reader, false);
 	} catch (...) {
 		ClearSaveLoadState();
@@ -3597,7 +4112,7 @@ SaveOrLoadResult LoadWithFilter(LoadFilter *reader)
 SaveOrLoadResult SaveOrLoad(const std::string &filename, SaveLoadOperation fop, DetailedFileType dft, Subdirectory sb, bool threaded, SaveModeFlags save_flags)
 {
 	/* An instance of saving is already active, so don't go saving again */
-	if (_sl.saveinprogress && fop == SLO_SAVE && dft == DFT_GAME_FILE && threaded) {
+	if (_sl->saveinprogress && fop == SLO_SAVE && dft == DFT_GAME_FILE && threaded) {
 		/* if not an autosave, but a user action, show error message */
 		if (!_do_autosave) ShowErrorMessage(STR_ERROR_SAVE_STILL_IN_PROGRESS, INVALID_STRING_ID, WL_ERROR);
 		return SL_OK;
@@ -3634,20 +4149,20 @@ SaveOrLoadResult SaveOrLoad(const std::string &filename, SaveLoadOperation fop,
 		assert(dft == DFT_GAME_FILE);
 		switch (fop) {
 			case SLO_CHECK:
-				_sl.action = SLA_LOAD_CHECK;
+				_sl->action = SLA_LOAD_CHECK;
 				break;
 
 			case SLO_LOAD:
-				_sl.action = SLA_LOAD;
+				_sl->action = SLA_LOAD;
 				break;
 
 			case SLO_SAVE:
-				_sl.action = SLA_SAVE;
+				_sl->action = SLA_SAVE;
 				break;
 
 			default: NOT_REACHED();
 		}
-		_sl.save_flags = save_flags;
+		_sl->save_flags = save_flags;
 
 		FILE *fh = (fop == SLO_SAVE) ? FioFOpenFile(filename, "wb", sb) : FioFOpenFile(filename, "rb", sb);
 
@@ -3699,13 +4214,179 @@ void DoAutoOrNetsave(FiosNumberedSaveName &counter, bool threaded)
 		strecpy(buf, counter.Filename().c_str(), lastof(buf));
 	}
 
-	DEBUG(sl, 2, "Autosaving to '%s'", buf);
-	if (SaveOrLoad(buf, SLO_SAVE, DFT_GAME_FILE, AUTOSAVE_DIR, threaded, SMF_ZSTD_OK) != SL_OK) {
+	SaveModeFlags flags = SMF_ZSTD_OK;
+	std::string filename = buf;
+	if (threaded && _settings_client.gui.autosave_delta_interval > 0) {
+		/* Only write a delta when the last full autosave was written successfully by this process. */
+		WaitTillSaved();
+		if (!_delta_save_base.filename.empty() && _delta_autosave_count < _settings_client.gui.autosave_delta_interval) {
+			_delta_autosave_count++;
+			flags |= SMF_DELTA;
+			if (StrEndsWith(filename, ".sav")) filename.resize(filename.size() - 4);
+			filename += ".delta";
+		} else {
+			_delta_autosave_count = 0;
+			flags |= SMF_DELTA_BASE;
+			_delta_save_filename = filename;
+		}
+	}
+
+	DEBUG(sl, 2, "Autosaving to '%s'", filename.c_str());
+#if defined(WITH_SNAPSHOT_AUTOSAVE)
+	/* The layout of full autosaves has to be known in this process, for the deltas against them. */
+	if (threaded && _settings_client.gui.autosave_snapshot && !(flags & (SMF_DELTA_BASE | SMF_DELTA)) && StartSnapshotSave(buf)) return;
+#endif
+	if (SaveOrLoad(filename, SLO_SAVE, DFT_GAME_FILE, AUTOSAVE_DIR, threaded, flags) != SL_OK) {
 		ShowErrorMessage(STR_ERROR_AUTOSAVE_FAILED, INVALID_STRING_ID, WL_ERROR);
 	}
 }
 
 
+/**
+ * Find the savegame format with the given tag.
+ * @param tag The tag.
+ * @return The format, or nullptr when there is no format which can load it.
+ */
+static const SaveLoadFormat *GetSavegameFormatByTag(uint32 tag)
+{
+	for (const SaveLoadFormat &slf : _saveload_formats) {
+		if (slf.tag == tag && slf.init_load != nullptr) return &slf;
+	}
+	return nullptr;
+}
+
+/**
+ * Rebuild a full savegame from a delta autosave and the full autosave it refers to.
+ * @param delta_name Name of the delta autosave, in the autosave directory.
+ * @param save_name Name of the savegame to write, in the save directory.
+ * @return nullptr on success, otherwise a description of what went wrong.
+ */
+const char *ReconstructDeltaSave(const std::string &delta_name, const std::string &save_name)
+{
+	WaitTillSaved();
+	const SaveLoadAction old_action = _sl->action;
+	_sl->action = SLA_SAVE;
+	auto guard = scope_guard([&]() {
+		_sl->action = old_action;
+	});
+
+	auto read = [](LoadFilter &reader, byte *buf, size_t length) {
+		while (length > 0) {
+			size_t count = reader.Read(buf, length);
+			if (count == 0) SlError(STR_GAME_SAVELOAD_ERROR_FILE_NOT_READABLE, "Unexpected end of file");
+			buf += count;
+			length -= count;
+		}
+	};
+	auto read_uint = [&](LoadFilter &reader, uint bytes) -> uint64 {
+		byte buf[8];
+		read(reader, buf, bytes);
+		uint64 value = 0;
+		for (uint i = 0; i < bytes; i++) value = (value << 8) | buf[i];
+		return value;
+	};
+	auto get_hash = [](const std::vector<byte> &data) -> uint64 {
+		crypto_blake2b_ctx ctx;
+		InitDeltaSaveHash(&ctx);
+		crypto_blake2b_update(&ctx, data.data(), data.size());
+		return FinishDeltaSaveHash(&ctx);
+	};
+
+	std::unique_ptr<LoadFilter> delta;
+	std::unique_ptr<LoadFilter> base;
+	std::unique_ptr<SaveFilter> output;
+	try {
+		FILE *fh = FioFOpenFile(delta_name, "rb", AUTOSAVE_DIR);
+		if (fh == nullptr) return "Cannot open the delta autosave";
+		delta.reset(new FileReader(fh));
+
+		uint32 hdr[2];
+		read(*delta, (byte *)hdr, sizeof(hdr));
+		if (hdr[0] != DELTA_SAVE_TAG) return "Not a delta autosave";
+		const SaveLoadFormat *fmt = GetSavegameFormatByTag(hdr[1]);
+		if (fmt == nullptr) return "Unsupported compression format";
+		delta.reset(fmt->init_load(delta.release()));
+
+		if (read_uint(*delta, 4) != DELTA_SAVE_VERSION) return "Unsupported delta autosave version";
+		std::string base_name((size_t)read_uint(*delta, 2), '\0');
+		read(*delta, (byte *)base_name.data(), base_name.size());
+		const uint64 base_size = read_uint(*delta, 8);
+		const uint64 base_hash = read_uint(*delta, 8);
+		const uint64 size = read_uint(*delta, 8);
+		const uint64 hash = read_uint(*delta, 8);
+
+		/* Load the uncompressed data of the full autosave the delta refers to. */
+		fh = FioFOpenFile(base_name, "rb", AUTOSAVE_DIR);
+		if (fh == nullptr) return "Cannot open the full autosave the delta refers to";
+		base.reset(new FileReader(fh));
+
+		uint32 base_hdr[2];
+		read(*base, (byte *)base_hdr, sizeof(base_hdr));
+		fmt = GetSavegameFormatByTag(base_hdr[0]);
+		if (fmt == nullptr) return "Unsupported compression format";
+		base.reset(fmt->init_load(base.release()));
+
+		/* The sizes in the header are not trusted for allocations, the data is read in blocks until the end of the file instead. */
+		std::vector<byte> base_data;
+		for (;;) {
+			const size_t start = base_data.size();
+			base_data.resize(start + DELTA_SAVE_BLOCK_SIZE);
+			const size_t count = base->Read(base_data.data() + start, DELTA_SAVE_BLOCK_SIZE);
+			base_data.resize(start + count);
+			if (count == 0 || base_data.size() > base_size) break;
+		}
+		base.reset();
+		if (base_data.size() != base_size || get_hash(base_data) != base_hash) return "The full autosave the delta refers to has been replaced";
+
+		/* Apply the delta. */
+		std::vector<byte> data;
+		data.reserve((size_t)std::min<uint64>(size, base_data.size()));
+		for (;;) {
+			const byte op = (byte)read_uint(*delta, 1);
+			if (op == DSO_END) break;
+			if (op == DSO_COPY) {
+				const uint64 offset = read_uint(*delta, 8);
+				const uint64 length = read_uint(*delta, 8);
+				if (offset > base_data.size() || length > base_data.size() - offset || length > size - data.size()) return "Corrupt delta autosave";
+				data.insert(data.end(), base_data.begin() + offset, base_data.begin() + offset + length);
+			} else if (op == DSO_INSERT) {
+				const uint64 length = read_uint(*delta, 8);
+				if (length > size - data.size()) return "Corrupt delta autosave";
+				for (uint64 done = 0; done < length; done += DELTA_SAVE_BLOCK_SIZE) {
+					const size_t start = data.size();
+					const size_t count = (size_t)std::min<uint64>(DELTA_SAVE_BLOCK_SIZE, length - done);
+					data.resize(start + count);
+					read(*delta, data.data() + start, count);
+				}
+			} else {
+				return "Corrupt delta autosave";
+			}
+		}
+		delta.reset();
+		if (data.size() != size || get_hash(data) != hash) return "Corrupt delta autosave";
+
+		/* Write it as a normal savegame, with the version of the full autosave. */
+		fh = FioFOpenFile(save_name, "wb", SAVE_DIR);
+		if (fh == nullptr) return "Cannot open the savegame for writing";
+		output.reset(new FileWriter(fh));
+
+		byte compression;
+		fmt = GetSavegameFormat(_savegame_format, &compression, SMF_ZSTD_OK);
+		uint32 save_hdr[2] = { fmt->tag, base_hdr[1] };
+		output->Write((byte *)save_hdr, sizeof(save_hdr));
+		output.reset(fmt->init_write(output.release(), compression));
+		output->Write(data.data(), data.size());
+		output->Finish();
+	} catch (const std::bad_alloc &) {
+		return "Not enough memory to reconstruct the savegame";
+	} catch (...) {
+		/* Skip the "colour" character */
+		return GetSaveLoadErrorString() + 3;
+	}
+
+	return nullptr;
+}
+
 /** Do a save when exiting the game (_settings_client.gui.autosave_on_exit) */
 void DoExitSave()
 {
@@ -55,6 +55,8 @@ enum SaveModeFlags : byte {
 	SMF_NONE             = 0,
 	SMF_NET_SERVER       = 1 << 0, ///< Network server save
 	SMF_ZSTD_OK          = 1 << 1, ///< Zstd OK
+	SMF_DELTA_BASE       = 1 << 2, ///< Full autosave which later delta autosaves refer to
+	SMF_DELTA            = 1 << 3, ///< Delta autosave, only containing what changed since the last #SMF_DELTA_BASE save
 };
 DECLARE_ENUM_AS_BIT_SET(SaveModeFlags);
 
@@ -69,6 +71,7 @@ void ProcessAsyncSaveFinish();
 void DoExitSave();
 
 void DoAutoOrNetsave(FiosNumberedSaveName &counter, bool threaded);
+const char *ReconstructDeltaSave(const std::string &delta_name, const std::string &save_name);
 
 SaveOrLoadResult SaveWithFilter(struct SaveFilter *writer, bool threaded, SaveModeFlags flags);
 SaveOrLoadResult LoadWithFilter(struct LoadFilter *reader);
@@ -93,6 +96,7 @@ struct ChunkHandler {
 	ChunkSaveLoadProc *ptrs_proc;       ///< Manipulate pointers in the chunk.
 	ChunkSaveLoadProc *load_check_proc; ///< Load procedure for game preview.
 	ChunkType type;                     ///< Type of the chunk. @see ChunkType
+	bool concurrent_save = false;       ///< Whether the save procedure does not modify any state shared with other chunks, and so may be run concurrently with them.
 };
 
 struct NullStruct {
@@ -175,6 +175,7 @@ struct MemoryDumper {
 
 	void FinaliseBlock();
 	void AllocateBuffer();
+	void Append(MemoryDumper &other);
 
 	inline void CheckBytes(size_t bytes)
 	{
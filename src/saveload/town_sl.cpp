@@ -361,7 +361,7 @@ static void Ptrs_TOWN()
 /** Chunk handler for towns. */
 static const ChunkHandler town_chunk_handlers[] = {
 	{ 'HIDS', Save_HIDS, Load_HIDS, nullptr,   nullptr, CH_ARRAY },
-	{ 'CITY', Save_TOWN, Load_TOWN, Ptrs_TOWN, nullptr, CH_ARRAY },
+	{ 'CITY', Save_TOWN, Load_TOWN, Ptrs_TOWN, nullptr, CH_ARRAY, true },
 };
 
 extern const ChunkHandlerTable _town_chunk_handlers(town_chunk_handlers);
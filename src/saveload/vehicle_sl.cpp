@@ -436,6 +436,17 @@ void AfterLoadVehicles(bool part_of_load)
 					if (_settings_game.vehicle.roadveh_acceleration_model != AM_ORIGINAL) {
 						rv->CargoChanged();
 					}
+
+					if (part_of_load && rv->route_hold_station != INVALID_STATION) {
+
+						Station *st = Station::GetIfValid(rv->route_hold_station);
+						if (st != nullptr) {
+							st->road_waiting_vehicles.push_back(rv);
+						} else {
+							rv->route_hold_tile = INVALID_TILE;
+							rv->route_hold_station = INVALID_STATION;
+						}
+					}
 				}
 				break;
 			}
@@ -829,6 +840,10 @@ SaveLoadTable GetVehicleDescription(VehicleType vt)
 		 SLE_CONDNULL(2,                                                               SLV_6, SLV_131),
 		 SLE_CONDNULL(16,                                                              SLV_2, SLV_144), // old reserved space
 		SLE_CONDVAR_X(RoadVehicle, critical_breakdown_count, SLE_UINT8,       SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_IMPROVED_BREAKDOWNS, 6)),
+		SLE_CONDVAR_X(RoadVehicle, route_hold_tile,      SLE_UINT32,                     SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_RV_ROUTE_HOLD)),
+		SLE_CONDVAR_X(RoadVehicle, route_hold_station,   SLE_UINT16,                     SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_RV_ROUTE_HOLD)),
+		SLE_CONDVAR_X(RoadVehicle, route_hold_trackdir,  SLE_UINT8,                      SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_RV_ROUTE_HOLD)),
+		SLE_CONDVAR_X(RoadVehicle, route_hold_layout_ctr, SLE_UINT32,                    SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_RV_ROUTE_HOLD)),
 	};
 
 	static const SaveLoad _ship_desc[] = {
@@ -1467,7 +1482,7 @@ void Load_VLKA()
 }
 
 static const ChunkHandler veh_chunk_handlers[] = {
-	{ 'VEHS', Save_VEHS, Load_VEHS, Ptrs_VEHS, nullptr, CH_SPARSE_ARRAY },
+	{ 'VEHS', Save_VEHS, Load_VEHS, Ptrs_VEHS, nullptr, CH_SPARSE_ARRAY, true },
 	{ 'VEOX', Save_VEOX, Load_VEOX, nullptr,   nullptr, CH_SPARSE_ARRAY },
 	{ 'VESR', Save_VESR, Load_VESR, nullptr,   nullptr, CH_SPARSE_ARRAY },
 	{ 'VENC', Save_VENC, Load_VENC, nullptr,   nullptr, CH_RIFF         },
@@ -19,6 +19,13 @@
  *
  * \li AIIndustryType::ResolveNewGRFID
  * \li AIObjectType::ResolveNewGRFID
+ * \li AITileList::ValuateNative
+ * \li AIVehicleList::ValuateNative
+ * \li AIVehicleList_Station::ValuateNative
+ * \li AIVehicleList_Depot::ValuateNative
+ * \li AIVehicleList_SharedOrders::ValuateNative
+ * \li AIVehicleList_Group::ValuateNative
+ * \li AIVehicleList_DefaultGroup::ValuateNative
  *
  * \b 12.0
  *
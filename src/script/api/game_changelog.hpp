@@ -19,6 +19,11 @@
  *
  * \li GSIndustryType::ResolveNewGRFID
  * \li GSObjectType::ResolveNewGRFID
+ * \li GSTileList::ValuateNative
+ * \li GSVehicleList::ValuateNative
+ * \li GSVehicleList_Station::ValuateNative
+ * \li GSVehicleList_Depot::ValuateNative
+ * \li GSVehicleList_SharedOrders::ValuateNative
  *
  * \b 12.0
  *
@@ -10,6 +10,7 @@
 #include "../../stdafx.h"
 #include "script_list.hpp"
 #include "script_controller.hpp"
+#include "../script_fatalerror.hpp"
 #include "../../debug.h"
 #include "../../script/squirrel.hpp"
 
@@ -842,6 +843,22 @@ SQInteger ScriptList::_nexti(HSQUIRRELVM vm)
 	return 1;
 }
 
+void ScriptList::ApplyNativeValuator(NativeValuatorProc *valuator)
+{
+	this->modifications++;
+
+	for (ScriptListMap::iterator iter = this->items.begin(); iter != this->items.end(); iter++) {
+		this->SetValue(iter->first, valuator(iter->first));
+
+		ScriptController::DecreaseOps(5);
+
+		/* Kill the script when valuating takes way too long, as Valuate does. */
+		if (ScriptController::GetOpsTillSuspend() < -1000000) {
+			throw Script_FatalError("excessive CPU usage in valuator function");
+		}
+	}
+}
+
 SQInteger ScriptList::Valuate(HSQUIRRELVM vm)
 {
 	this->modifications++;
@@ -41,6 +41,18 @@ private:
 	bool initialized;             ///< Whether an iteration has been started
 	int modifications;            ///< Number of modification that has been done. To prevent changing data while valuating.
 
+protected:
+	/** Native function computing the value of a single item. */
+	typedef int64 NativeValuatorProc(int64 item);
+
+	/**
+	 * Give all items a value computed by a native function, without calling back into the script VM per item.
+	 * Each item is charged the same number of operations as the bookkeeping of Valuate,
+	 *  and the script is killed when valuating takes way too long.
+	 * @param valuator The function computing the value of an item.
+	 */
+	void ApplyNativeValuator(NativeValuatorProc *valuator);
+
 public:
 	typedef std::set<int64> ScriptItemList;                   ///< The list of items inside the bucket
 	typedef std::map<int64, ScriptItemList> ScriptListBucket; ///< The bucket list per value
@@ -10,6 +10,7 @@
 #include "../../stdafx.h"
 #include "script_tilelist.hpp"
 #include "script_industry.hpp"
+#include "script_tile.hpp"
 #include "../../industry.h"
 #include "../../station_base.h"
 
@@ -47,6 +48,26 @@ void ScriptTileList::RemoveTile(TileIndex tile)
 	this->RemoveItem(tile);
 }
 
+void ScriptTileList::ValuateNative(TileValuator valuator)
+{
+	switch (valuator) {
+		case TV_IS_BUILDABLE:    this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::IsBuildable(tile) ? 1 : 0; }); break;
+		case TV_IS_WATER_TILE:   this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::IsWaterTile(tile) ? 1 : 0; }); break;
+		case TV_IS_SEA_TILE:     this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::IsSeaTile(tile) ? 1 : 0; }); break;
+		case TV_IS_COAST_TILE:   this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::IsCoastTile(tile) ? 1 : 0; }); break;
+		case TV_IS_STATION_TILE: this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::IsStationTile(tile) ? 1 : 0; }); break;
+		case TV_HAS_TREE:        this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::HasTreeOnTile(tile) ? 1 : 0; }); break;
+		case TV_SLOPE:           this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::GetSlope(tile); }); break;
+		case TV_MIN_HEIGHT:      this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::GetMinHeight(tile); }); break;
+		case TV_MAX_HEIGHT:      this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::GetMaxHeight(tile); }); break;
+		case TV_OWNER:           this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::GetOwner(tile); }); break;
+		case TV_TERRAIN_TYPE:    this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::GetTerrainType(tile); }); break;
+		case TV_TOWN_AUTHORITY:  this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::GetTownAuthority(tile); }); break;
+		case TV_CLOSEST_TOWN:    this->ApplyNativeValuator([](int64 tile) -> int64 { return ScriptTile::GetClosestTown(tile); }); break;
+		default: break;
+	}
+}
+
 /**
  * Helper to get list of tiles that will cover an industry's production or acceptance.
  * @param i Industry in question
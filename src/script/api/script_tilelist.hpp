@@ -20,6 +20,38 @@
  */
 class ScriptTileList : public ScriptList {
 public:
+	/**
+	 * Tile properties which can be valuated natively, see ValuateNative().
+	 */
+	enum TileValuator {
+		TV_IS_BUILDABLE,    ///< Value of ScriptTile::IsBuildable.
+		TV_IS_WATER_TILE,   ///< Value of ScriptTile::IsWaterTile.
+		TV_IS_SEA_TILE,     ///< Value of ScriptTile::IsSeaTile.
+		TV_IS_COAST_TILE,   ///< Value of ScriptTile::IsCoastTile.
+		TV_IS_STATION_TILE, ///< Value of ScriptTile::IsStationTile.
+		TV_HAS_TREE,        ///< Value of ScriptTile::HasTreeOnTile.
+		TV_SLOPE,           ///< Value of ScriptTile::GetSlope.
+		TV_MIN_HEIGHT,      ///< Value of ScriptTile::GetMinHeight.
+		TV_MAX_HEIGHT,      ///< Value of ScriptTile::GetMaxHeight.
+		TV_OWNER,           ///< Value of ScriptTile::GetOwner.
+		TV_TERRAIN_TYPE,    ///< Value of ScriptTile::GetTerrainType.
+		TV_TOWN_AUTHORITY,  ///< Value of ScriptTile::GetTownAuthority.
+		TV_CLOSEST_TOWN,    ///< Value of ScriptTile::GetClosestTown.
+	};
+
+	/**
+	 * Give all tiles in the list the value of the given tile property.
+	 * This gives the same result as calling Valuate() with the matching ScriptTile function,
+	 *  but the valuation is done natively in a single pass, without calling a
+	 *  valuator function for every tile.
+	 * @param valuator The tile property to valuate.
+	 * @note Nothing happens when valuator is not a valid TileValuator.
+	 * @note Example:
+	 *  list.ValuateNative(ScriptTileList.TV_IS_BUILDABLE);
+	 *  list.KeepValue(1);
+	 */
+	void ValuateNative(TileValuator valuator);
+
 	/**
 	 * Adds the rectangle between tile_from and tile_to to the to-be-evaluated tiles.
 	 * @param tile_from One corner of the tiles to add.
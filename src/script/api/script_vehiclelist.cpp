@@ -25,6 +25,34 @@ ScriptVehicleList::ScriptVehicleList()
 	}
 }
 
+/* static */ ScriptList::NativeValuatorProc *ScriptVehicleList::GetNativeValuator(VehicleValuator valuator)
+{
+	switch (valuator) {
+		case VV_LOCATION:            return [](int64 v) -> int64 { return ScriptVehicle::GetLocation(v); };
+		case VV_ENGINE_TYPE:         return [](int64 v) -> int64 { return ScriptVehicle::GetEngineType(v); };
+		case VV_UNIT_NUMBER:         return [](int64 v) -> int64 { return ScriptVehicle::GetUnitNumber(v); };
+		case VV_AGE:                 return [](int64 v) -> int64 { return ScriptVehicle::GetAge(v); };
+		case VV_AGE_LEFT:            return [](int64 v) -> int64 { return ScriptVehicle::GetAgeLeft(v); };
+		case VV_CURRENT_SPEED:       return [](int64 v) -> int64 { return ScriptVehicle::GetCurrentSpeed(v); };
+		case VV_STATE:               return [](int64 v) -> int64 { return ScriptVehicle::GetState(v); };
+		case VV_RUNNING_COST:        return [](int64 v) -> int64 { return ScriptVehicle::GetRunningCost(v); };
+		case VV_PROFIT_THIS_YEAR:    return [](int64 v) -> int64 { return ScriptVehicle::GetProfitThisYear(v); };
+		case VV_PROFIT_LAST_YEAR:    return [](int64 v) -> int64 { return ScriptVehicle::GetProfitLastYear(v); };
+		case VV_CURRENT_VALUE:       return [](int64 v) -> int64 { return ScriptVehicle::GetCurrentValue(v); };
+		case VV_VEHICLE_TYPE:        return [](int64 v) -> int64 { return ScriptVehicle::GetVehicleType(v); };
+		case VV_IS_STOPPED_IN_DEPOT: return [](int64 v) -> int64 { return ScriptVehicle::IsStoppedInDepot(v) ? 1 : 0; };
+		case VV_GROUP_ID:            return [](int64 v) -> int64 { return ScriptVehicle::GetGroupID(v); };
+		case VV_RELIABILITY:         return [](int64 v) -> int64 { return ScriptVehicle::GetReliability(v); };
+		default: return nullptr;
+	}
+}
+
+void ScriptVehicleList::ValuateNative(VehicleValuator valuator)
+{
+	NativeValuatorProc *proc = ScriptVehicleList::GetNativeValuator(valuator);
+	if (proc != nullptr) this->ApplyNativeValuator(proc);
+}
+
 ScriptVehicleList_Station::ScriptVehicleList_Station(StationID station_id)
 {
 	if (!ScriptBaseStation::IsValidBaseStation(station_id)) return;
@@ -41,6 +69,12 @@ ScriptVehicleList_Station::ScriptVehicleList_Station(StationID station_id)
 	}
 }
 
+void ScriptVehicleList_Station::ValuateNative(ScriptVehicleList::VehicleValuator valuator)
+{
+	NativeValuatorProc *proc = ScriptVehicleList::GetNativeValuator(valuator);
+	if (proc != nullptr) this->ApplyNativeValuator(proc);
+}
+
 ScriptVehicleList_Depot::ScriptVehicleList_Depot(TileIndex tile)
 {
 	if (!ScriptMap::IsValidTile(tile)) return;
@@ -89,6 +123,12 @@ ScriptVehicleList_Depot::ScriptVehicleList_Depot(TileIndex tile)
 	}
 }
 
+void ScriptVehicleList_Depot::ValuateNative(ScriptVehicleList::VehicleValuator valuator)
+{
+	NativeValuatorProc *proc = ScriptVehicleList::GetNativeValuator(valuator);
+	if (proc != nullptr) this->ApplyNativeValuator(proc);
+}
+
 ScriptVehicleList_SharedOrders::ScriptVehicleList_SharedOrders(VehicleID vehicle_id)
 {
 	if (!ScriptVehicle::IsValidVehicle(vehicle_id)) return;
@@ -98,6 +138,12 @@ ScriptVehicleList_SharedOrders::ScriptVehicleList_SharedOrders(VehicleID vehicle
 	}
 }
 
+void ScriptVehicleList_SharedOrders::ValuateNative(ScriptVehicleList::VehicleValuator valuator)
+{
+	NativeValuatorProc *proc = ScriptVehicleList::GetNativeValuator(valuator);
+	if (proc != nullptr) this->ApplyNativeValuator(proc);
+}
+
 ScriptVehicleList_Group::ScriptVehicleList_Group(GroupID group_id)
 {
 	if (!ScriptGroup::IsValidGroup((ScriptGroup::GroupID)group_id)) return;
@@ -109,6 +155,12 @@ ScriptVehicleList_Group::ScriptVehicleList_Group(GroupID group_id)
 	}
 }
 
+void ScriptVehicleList_Group::ValuateNative(ScriptVehicleList::VehicleValuator valuator)
+{
+	NativeValuatorProc *proc = ScriptVehicleList::GetNativeValuator(valuator);
+	if (proc != nullptr) this->ApplyNativeValuator(proc);
+}
+
 ScriptVehicleList_DefaultGroup::ScriptVehicleList_DefaultGroup(ScriptVehicle::VehicleType vehicle_type)
 {
 	if (vehicle_type < ScriptVehicle::VT_RAIL || vehicle_type > ScriptVehicle::VT_AIR) return;
@@ -119,3 +171,9 @@ ScriptVehicleList_DefaultGroup::ScriptVehicleList_DefaultGroup(ScriptVehicle::Ve
 		}
 	}
 }
+
+void ScriptVehicleList_DefaultGroup::ValuateNative(ScriptVehicleList::VehicleValuator valuator)
+{
+	NativeValuatorProc *proc = ScriptVehicleList::GetNativeValuator(valuator);
+	if (proc != nullptr) this->ApplyNativeValuator(proc);
+}
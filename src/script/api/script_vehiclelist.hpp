@@ -20,7 +20,49 @@
  */
 class ScriptVehicleList : public ScriptList {
 public:
+	/**
+	 * Vehicle properties which can be valuated natively, see ValuateNative().
+	 */
+	enum VehicleValuator {
+		VV_LOCATION,            ///< Value of ScriptVehicle::GetLocation.
+		VV_ENGINE_TYPE,         ///< Value of ScriptVehicle::GetEngineType.
+		VV_UNIT_NUMBER,         ///< Value of ScriptVehicle::GetUnitNumber.
+		VV_AGE,                 ///< Value of ScriptVehicle::GetAge.
+		VV_AGE_LEFT,            ///< Value of ScriptVehicle::GetAgeLeft.
+		VV_CURRENT_SPEED,       ///< Value of ScriptVehicle::GetCurrentSpeed.
+		VV_STATE,               ///< Value of ScriptVehicle::GetState.
+		VV_RUNNING_COST,        ///< Value of ScriptVehicle::GetRunningCost.
+		VV_PROFIT_THIS_YEAR,    ///< Value of ScriptVehicle::GetProfitThisYear.
+		VV_PROFIT_LAST_YEAR,    ///< Value of ScriptVehicle::GetProfitLastYear.
+		VV_CURRENT_VALUE,       ///< Value of ScriptVehicle::GetCurrentValue.
+		VV_VEHICLE_TYPE,        ///< Value of ScriptVehicle::GetVehicleType.
+		VV_IS_STOPPED_IN_DEPOT, ///< Value of ScriptVehicle::IsStoppedInDepot.
+		VV_GROUP_ID,            ///< Value of ScriptVehicle::GetGroupID.
+		VV_RELIABILITY,         ///< Value of ScriptVehicle::GetReliability.
+	};
+
 	ScriptVehicleList();
+
+	/**
+	 * Give all vehicles in the list the value of the given vehicle property.
+	 * This gives the same result as calling Valuate() with the matching ScriptVehicle function,
+	 *  but the valuation is done natively in a single pass, without calling a
+	 *  valuator function for every vehicle.
+	 * @param valuator The vehicle property to valuate.
+	 * @note Nothing happens when valuator is not a valid VehicleValuator.
+	 * @note Example:
+	 *  list.ValuateNative(ScriptVehicleList.VV_PROFIT_LAST_YEAR);
+	 *  list.KeepBelowValue(0);
+	 */
+	void ValuateNative(VehicleValuator valuator);
+
+	/**
+	 * Internal function to get the native function computing a vehicle property, shared by all vehicle lists.
+	 * @param valuator The vehicle property to valuate.
+	 * @return The function, or nullptr when valuator is not a valid VehicleValuator.
+	 * @api -all
+	 */
+	static NativeValuatorProc *GetNativeValuator(VehicleValuator valuator);
 };
 
 /**
@@ -35,6 +77,14 @@ public:
 	 * @pre ScriptBaseStation::IsValidBaseStation(station_id)
 	 */
 	ScriptVehicleList_Station(StationID station_id);
+
+	/**
+	 * Give all vehicles in the list the value of the given vehicle property.
+	 * @param valuator The vehicle property to valuate.
+	 * @note Nothing happens when valuator is not a valid VehicleValuator.
+	 * @see ScriptVehicleList::ValuateNative
+	 */
+	void ValuateNative(ScriptVehicleList::VehicleValuator valuator);
 };
 
 /**
@@ -52,6 +102,14 @@ public:
 	 * @param tile The tile of the depot to get the list of vehicles from, which have orders to it.
 	 */
 	ScriptVehicleList_Depot(TileIndex tile);
+
+	/**
+	 * Give all vehicles in the list the value of the given vehicle property.
+	 * @param valuator The vehicle property to valuate.
+	 * @note Nothing happens when valuator is not a valid VehicleValuator.
+	 * @see ScriptVehicleList::ValuateNative
+	 */
+	void ValuateNative(ScriptVehicleList::VehicleValuator valuator);
 };
 
 /**
@@ -65,6 +123,14 @@ public:
 	 * @param vehicle_id The vehicle that the rest shared orders with.
 	 */
 	ScriptVehicleList_SharedOrders(VehicleID vehicle_id);
+
+	/**
+	 * Give all vehicles in the list the value of the given vehicle property.
+	 * @param valuator The vehicle property to valuate.
+	 * @note Nothing happens when valuator is not a valid VehicleValuator.
+	 * @see ScriptVehicleList::ValuateNative
+	 */
+	void ValuateNative(ScriptVehicleList::VehicleValuator valuator);
 };
 
 /**
@@ -78,6 +144,14 @@ public:
 	 * @param group_id The ID of the group the vehicles are in.
 	 */
 	ScriptVehicleList_Group(GroupID group_id);
+
+	/**
+	 * Give all vehicles in the list the value of the given vehicle property.
+	 * @param valuator The vehicle property to valuate.
+	 * @note Nothing happens when valuator is not a valid VehicleValuator.
+	 * @see ScriptVehicleList::ValuateNative
+	 */
+	void ValuateNative(ScriptVehicleList::VehicleValuator valuator);
 };
 
 /**
@@ -91,6 +165,14 @@ public:
 	 * @param vehicle_type The VehicleType to get the list of vehicles for.
 	 */
 	ScriptVehicleList_DefaultGroup(ScriptVehicle::VehicleType vehicle_type);
+
+	/**
+	 * Give all vehicles in the list the value of the given vehicle property.
+	 * @param valuator The vehicle property to valuate.
+	 * @note Nothing happens when valuator is not a valid VehicleValuator.
+	 * @see ScriptVehicleList::ValuateNative
+	 */
+	void ValuateNative(ScriptVehicleList::VehicleValuator valuator);
 };
 
 #endif /* SCRIPT_VEHICLELIST_HPP */
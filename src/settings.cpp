@@ -1966,7 +1966,15 @@ static GRFConfig *GRFLoadConfig(IniFile &ini, const char *grpname, bool is_stati
 
 	if (group == nullptr) return nullptr;
 
-	uint num_grfs = 0;
+	/** A GRF from the config file, of which the details still have to be filled. */
+	struct LoadItem {
+		const IniItem *item;   ///< The item in the config file.
+		const char *filename;  ///< The filename part of the item name.
+		bool invalid_params;   ///< Whether the parameters could not be parsed.
+	};
+	std::vector<LoadItem> load_items;
+	std::vector<GRFConfig *> configs;
+
 	for (item = group->item; item != nullptr; item = item->next) {
 		GRFConfig *c = nullptr;
 
@@ -1995,18 +2003,39 @@ static GRFConfig *GRFLoadConfig(IniFile &ini, const char *grpname, bool is_stati
 		if (c == nullptr) c = new GRFConfig(filename);
 
 		/* Parse parameters */
+		bool invalid_params = false;
 		if (item->value.has_value() && !item->value->empty()) {
 			int count = ParseIntList(item->value->c_str(), c->param, lengthof(c->param));
 			if (count < 0) {
-				SetDParamStr(0, filename);
-				ShowErrorMessage(STR_CONFIG_ERROR, STR_CONFIG_ERROR_ARRAY, WL_CRITICAL);
+				invalid_params = true;
 				count = 0;
 			}
 			c->num_params = count;
 		}
 
+		load_items.push_back({ item, filename, invalid_params });
+		configs.push_back(c);
+	}
+
+	/* Fill the details of all GRFs at once, the results are handled in the order of the config file. */
+	uint num_grfs = 0;
+	bool too_many = false;
+	size_t index = 0;
+	FillGRFDetailsList(configs, is_static, NEWGRF_DIR, [&](GRFConfig *c, bool valid) {
+		const LoadItem &load_item = load_items[index++];
+		if (too_many) {
+			delete c;
+			return;
+		}
+
+		const char *filename = load_item.filename;
+		if (load_item.invalid_params) {
+			SetDParamStr(0, filename);
+			ShowErrorMessage(STR_CONFIG_ERROR, STR_CONFIG_ERROR_ARRAY, WL_CRITICAL);
+		}
+
 		/* Check if item is valid */
-		if (!FillGRFDetails(c, is_static) || HasBit(c->flags, GCF_INVALID)) {
+		if (!valid || HasBit(c->flags, GCF_INVALID)) {
 			if (c->status == GCS_NOT_FOUND) {
 				SetDParam(1, STR_CONFIG_ERROR_INVALID_GRF_NOT_FOUND);
 			} else if (HasBit(c->flags, GCF_UNSAFE)) {
@@ -2019,10 +2048,10 @@ static GRFConfig *GRFLoadConfig(IniFile &ini, const char *grpname, bool is_stati
 				SetDParam(1, STR_CONFIG_ERROR_INVALID_GRF_UNKNOWN);
 			}
 
-			SetDParamStr(0, StrEmpty(filename) ? item->name : filename);
+			SetDParamStr(0, StrEmpty(filename) ? load_item.item->name : filename);
 			ShowErrorMessage(STR_CONFIG_ERROR, STR_CONFIG_ERROR_INVALID_GRF, WL_CRITICAL);
 			delete c;
-			continue;
+			return;
 		}
 
 		/* Check for duplicate GRFID (will also check for duplicate filenames) */
@@ -2038,7 +2067,7 @@ static GRFConfig *GRFLoadConfig(IniFile &ini, const char *grpname, bool is_stati
 		}
 		if (duplicate) {
 			delete c;
-			continue;
+			return;
 		}
 
 		if (is_static) {
@@ -2047,13 +2076,15 @@ static GRFConfig *GRFLoadConfig(IniFile &ini, const char *grpname, bool is_stati
 		} else if (++num_grfs > NETWORK_MAX_GRF_COUNT) {
 			/* Check we will not load more non-static NewGRFs than allowed. This could trigger issues for game servers. */
 			ShowErrorMessage(STR_CONFIG_ERROR, STR_NEWGRF_ERROR_TOO_MANY_NEWGRFS_LOADED, WL_CRITICAL);
-			break;
+			too_many = true;
+			delete c;
+			return;
 		}
 
 		/* Add item to list */
 		*curr = c;
 		curr = &c->next;
-	}
+	});
 
 	return first;
 }
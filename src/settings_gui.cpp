@@ -1912,6 +1912,7 @@ static SettingsContainer &GetSettingsTree()
 			interface->Add(new SettingEntry("gui.autosave"));
 			interface->Add(new ConditionallyHiddenSettingEntry("gui.autosave_custom_days", []() -> bool { return _settings_client.gui.autosave != 5; }));
 			interface->Add(new ConditionallyHiddenSettingEntry("gui.autosave_custom_minutes", []() -> bool { return _settings_client.gui.autosave != 6; }));
+			interface->Add(new ConditionallyHiddenSettingEntry("gui.autosave_delta_interval", []() -> bool { return _settings_client.gui.autosave == 0 || !_settings_client.gui.threaded_saves; }));
 			interface->Add(new SettingEntry("gui.autosave_on_network_disconnect"));
 			interface->Add(new SettingEntry("gui.savegame_overwrite_confirm"));
 			interface->Add(new SettingEntry("gui.toolbar_pos"));
@@ -2224,6 +2225,7 @@ static SettingsContainer &GetSettingsTree()
 				cdist->Add(new SettingEntry("linkgraph.short_path_saturation"));
 				cdist->Add(new SettingEntry("linkgraph.recalc_not_scaled_by_daylength"));
 				cdist->Add(new SettingEntry("linkgraph.aircraft_link_scale"));
+				cdist->Add(new SettingEntry("linkgraph.recalc_skip_unchanged"));
 			}
 			SettingsPage *treedist = environment->Add(new SettingsPage(STR_CONFIG_SETTING_ENVIRONMENT_TREES));
 			{
@@ -153,6 +153,8 @@ struct GUISettings : public TimeSettings {
 	uint16 autosave_custom_minutes;          ///< custom autosave interval in real-time minutes
 	bool   threaded_saves;                   ///< should we do threaded saves?
 	bool   keep_all_autosave;                ///< name the autosave in a different way
+	bool   autosave_snapshot;                ///< save autosaves from a forked copy of the process, so that the game does not pause (not on Windows or OSX)
+	uint8  autosave_delta_interval;          ///< number of delta autosaves, holding only what changed since the last full autosave, between full autosaves (0 = off)
 	bool   autosave_on_exit;                 ///< save an autosave when you quit the game, but do not ask "Do you really want to quit?"
 	bool   autosave_on_network_disconnect;   ///< save an autosave when you get disconnected from a network game with an error?
 	uint8  date_format_in_default_names;     ///< should the default savegame/screenshot name use long dates (31th Dec 2008), short dates (31-12-2008) or ISO dates (2008-12-31)
@@ -704,6 +706,7 @@ struct LinkGraphSettings {
 	uint8 demand_distance;                      ///< influence of distance between stations on the demand function
 	uint8 short_path_saturation;                ///< percentage up to which short paths are saturated before saturating most capacious paths
 	uint16 aircraft_link_scale;                 ///< scale effective distance of aircraft links
+	uint8 recalc_skip_unchanged;                ///< maximum number of consecutive recalculations skipped for components which haven't changed significantly (0 = never skip)
 
 	inline DistributionType GetDistributionType(CargoID cargo) const {
 		if (this->distribution_per_cargo[cargo] != DT_PER_CARGO_DEFAULT) return this->distribution_per_cargo[cargo];
@@ -56,6 +56,7 @@ protected:
 	uint8 filter_type;                        ///< what criteria to filter on
 	uint16 resort_timer;                      ///< resort list after a given amount of ticks if set
 	uint16 resort_interval;                   ///< value to re-initialise resort_timer with after sorting
+	size_t presorted_count;                   ///< number of leading items which are already in sort order at the next resort
 
 	/**
 	 * Check if the list is sortable
@@ -83,7 +84,8 @@ public:
 		sort_type(0),
 		filter_type(0),
 		resort_timer(1),
-		resort_interval(DAY_TICKS * 10) /* Resort every 10 days by default */
+		resort_interval(DAY_TICKS * 10), /* Resort every 10 days by default */
+		presorted_count(0)
 	{};
 
 	/**
@@ -106,6 +108,7 @@ public:
 		if (this->sort_type != n_type) {
 			SETBITS(this->flags, VL_RESORT);
 			this->sort_type = n_type;
+			this->presorted_count = 0;
 		}
 	}
 
@@ -136,6 +139,7 @@ public:
 			CLRBITS(this->flags, VL_DESC);
 		}
 		this->sort_type = l.criteria;
+		this->presorted_count = 0;
 	}
 
 	/**
@@ -201,6 +205,7 @@ public:
 	{
 		if (--this->resort_timer == 0) {
 			SETBITS(this->flags, VL_RESORT);
+			this->presorted_count = 0;
 			this->ResetResortTimer();
 			return true;
 		}
@@ -214,6 +219,7 @@ public:
 	void ForceResort()
 	{
 		SETBITS(this->flags, VL_RESORT);
+		this->presorted_count = 0;
 	}
 
 	void SetResortInterval(uint16 resort_interval)
@@ -240,6 +246,7 @@ public:
 	void ToggleSortOrder()
 	{
 		this->flags ^= VL_DESC;
+		this->presorted_count = 0;
 
 		if (this->IsSortable()) MemReverseT(std::vector<T>::data(), std::vector<T>::size());
 	}
@@ -268,14 +275,42 @@ public:
 
 		CLRBITS(this->flags, VL_RESORT);
 
+		const size_t presorted = this->presorted_count;
+		this->presorted_count = 0;
+
 		this->ResetResortTimer();
 
 		/* Do not sort when the list is not sortable */
 		if (!this->IsSortable()) return false;
 
 		const bool desc = (this->flags & VL_DESC) != 0;
+		auto comp = [&](const T &a, const T &b) { return desc ? compare(b, a) : compare(a, b); };
+
+		if (presorted > 0) {
+			/* Only sort the items which were added after the presorted ones, and merge both runs. */
+			if (presorted >= std::vector<T>::size()) return false;
+			std::sort(std::vector<T>::begin() + presorted, std::vector<T>::end(), comp);
+
+			std::vector<T> merged;
+			merged.reserve(std::vector<T>::size());
+			auto first = std::vector<T>::begin();
+			auto middle = first + presorted;
+			auto second = middle;
+			auto last = std::vector<T>::end();
+			while (first != middle && second != last) {
+				if (comp(*second, *first)) {
+					merged.push_back(*second++);
+				} else {
+					merged.push_back(*first++);
+				}
+			}
+			merged.insert(merged.end(), first, middle);
+			merged.insert(merged.end(), second, last);
+			std::vector<T>::swap(merged);
+			return true;
+		}
 
-		std::sort(std::vector<T>::begin(), std::vector<T>::end(), [&](const T &a, const T &b) { return desc ? compare(b, a) : compare(a, b); });
+		std::sort(std::vector<T>::begin(), std::vector<T>::end(), comp);
 		return true;
 	}
 
@@ -398,6 +433,19 @@ public:
 	{
 		CLRBITS(this->flags, VL_REBUILD);
 		SETBITS(this->flags, VL_RESORT);
+		this->presorted_count = 0;
+	}
+
+	/**
+	 * Notify the sortlist that the rebuild is done, and that the leading items kept their sort order
+	 *
+	 * @param presorted Number of leading items which are in sort order, only the remaining items are sorted and merged in.
+	 * @note This forces a resort
+	 */
+	void RebuildDone(size_t presorted)
+	{
+		this->RebuildDone();
+		this->presorted_count = presorted;
 	}
 };
 
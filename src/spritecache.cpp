@@ -20,6 +20,10 @@
 #include "core/mem_func.hpp"
 #include "video/video_driver.hpp"
 #include "scope_info.h"
+#include "rev.h"
+#include "thread.h"
+#include "fileio_func.h"
+#include "string_func.h"
 
 #include "table/sprites.h"
 #include "table/strings.h"
@@ -29,6 +33,20 @@
 
 #include <vector>
 #include <algorithm>
+#include <map>
+#include <atomic>
+
+#if defined(_WIN32)
+#include <share.h>
+#include <io.h>
+#endif
+#if defined(UNIX) && !defined(__EMSCRIPTEN__)
+#include <sys/mman.h>
+#include <sys/file.h>
+#endif
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
 
 #include "safeguards.h"
 
@@ -495,6 +513,446 @@ static void *ReadRecolourSprite(SpriteFile &file, uint num)
 	return dest;
 }
 
+/**
+ * Get the directory of an on-disk sprite cache, creating it when needed.
+ * @param name Name of the cache, which is its subdirectory of the cache directory.
+ * @return The directory, or an empty string if there is no directory to keep caches in.
+ */
+static std::string GetSpriteCacheDirectory(const char *name)
+{
+	/* Unlike FioFindDirectory, don't fall back to the personal directory itself. */
+	for (Searchpath sp : _valid_searchpaths) {
+		std::string dir = FioGetDirectory(sp, CACHE_DIR);
+		if (!FileExists(dir)) continue;
+		dir += name;
+		AppendPathSeparator(dir);
+		FioCreateDirectory(dir);
+		return dir;
+	}
+	return std::string();
+}
+
+/** Upper limit of the size of the on-disk encoded sprite store in MiB, 0 to disable the store. */
+uint _sprite_disk_cache_size = 0;
+
+/**
+ * Store of blitter-encoded sprites on disk, used as second level cache behind the sprite cache.
+ * Sprites of GRFs with a known MD5 checksum are stored after being encoded, and copied from the
+ * store instead of being decoded, resized and encoded again when they were evicted from the
+ * sprite cache, both later in the same run and in subsequent runs.
+ *
+ * There is one store file per profile, which covers everything besides the GRF file contents
+ * which influences the encoded result: the game revision, the blitter and the zoom settings.
+ * Store files of other profiles are removed when a store file is created, and a store file
+ * is started over when it reaches the size limit.
+ * The file is a header followed by records, each consisting of a key, the data size, a checksum
+ * of the data and the data. The file is locked while it is open, so an instance which finds it
+ * in use by another instance runs without the store. Where supported, the file is memory mapped for reading.
+ */
+class EncodedSpriteStore {
+	static const uint32 MAGIC = 'O' | ('S' << 8) | ('P' << 16) | ('S' << 24);
+	static const uint32 RECORD_MAGIC = 'S' | ('P' << 8) | ('R' << 16) | ('E' << 24);
+	static const uint32 VERSION = 2;
+	static const size_t HEADER_SIZE = 16;
+	static const size_t RECORD_HEADER_SIZE = 40;
+
+	/** Key of a stored sprite. */
+	struct Key {
+		uint8 md5sum[16];
+		uint64 file_pos;
+		uint8 type;
+
+		bool operator<(const Key &other) const
+		{
+			int cmp = memcmp(this->md5sum, other.md5sum, sizeof(this->md5sum));
+			if (cmp != 0) return cmp < 0;
+			if (this->file_pos != other.file_pos) return this->file_pos < other.file_pos;
+			return this->type < other.type;
+		}
+	};
+
+	/** Location of a stored sprite in the file. */
+	struct Location {
+		size_t offset;   ///< Offset of the sprite data.
+		uint32 size;     ///< Size of the sprite data.
+		uint32 checksum; ///< Checksum of the sprite data.
+	};
+
+	/** Scanner which removes the store files of other profiles. */
+	struct StaleFileRemover : FileScanner {
+		std::string keep; ///< Store file to keep.
+
+		bool AddFile(const std::string &filename, size_t basepath_length, const std::string &tar_filename) override
+		{
+			/* Store files which are in use by other instances either cannot be removed, or stay usable until they are closed. */
+			if (filename != this->keep) remove(filename.c_str());
+			return true;
+		}
+	};
+
+	bool open = false;                         ///< Whether a store file is open.
+	uint64 profile = 0;                        ///< Profile of the open store file.
+	FILE *file = nullptr;                      ///< Handle of the store file.
+	size_t file_size = 0;                      ///< Size of the valid content of the store file.
+	bool dirty = false;                        ///< Whether records were written which were not flushed yet.
+	btree::btree_map<Key, Location> index;     ///< Location of all stored sprites.
+#if defined(UNIX) && !defined(__EMSCRIPTEN__)
+	const byte *map_ptr = nullptr;             ///< Memory mapping of the store file.
+	size_t map_size = 0;                       ///< Size of the memory mapping.
+
+	void Unmap()
+	{
+		if (this->map_ptr != nullptr) munmap(const_cast<byte *>(this->map_ptr), this->map_size);
+		this->map_ptr = nullptr;
+		this->map_size = 0;
+	}
+
+	void Map()
+	{
+		this->Unmap();
+		if (this->file_size == 0) return;
+		void *ptr = mmap(nullptr, this->file_size, PROT_READ, MAP_SHARED, fileno(this->file), 0);
+		if (ptr == MAP_FAILED) return;
+		this->map_ptr = (const byte *)ptr;
+		this->map_size = this->file_size;
+	}
+#endif
+
+	static uint32 ReadU32(const byte *buf) { return buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uint32)buf[3] << 24); }
+	static uint64 ReadU64(const byte *buf) { return ReadU32(buf) | ((uint64)ReadU32(buf + 4) << 32); }
+
+	static void WriteU32(byte *buf, uint32 value)
+	{
+		for (uint i = 0; i < 4; i++) buf[i] = GB(value, i * 8, 8);
+	}
+
+	static void WriteU64(byte *buf, uint64 value)
+	{
+		WriteU32(buf, (uint32)value);
+		WriteU32(buf + 4, (uint32)(value >> 32));
+	}
+
+	/**
+	 * Get the checksum of the data of a record.
+	 * @param data The data.
+	 * @param size Size of the data.
+	 * @return The checksum.
+	 */
+	static uint32 GetChecksum(const byte *data, size_t size)
+	{
+		/* FNV-1a */
+		uint32 hash = 0x811C9DC5;
+		for (size_t i = 0; i < size; i++) {
+			hash ^= data[i];
+			hash *= 0x01000193;
+		}
+		return hash;
+	}
+
+	static Key MakeKey(const SpriteCache *sc)
+	{
+		Key key;
+		memcpy(key.md5sum, sc->file->md5sum, sizeof(key.md5sum));
+		key.file_pos = sc->file_pos;
+		key.type = sc->GetType() | (sc->file->NeedsPaletteRemap() ? 0x80 : 0);
+		return key;
+	}
+
+	/**
+	 * Get the upper limit of the size of a store file.
+	 * @return The size in bytes.
+	 */
+	static size_t GetMaxSize()
+	{
+		return (size_t)_sprite_disk_cache_size * 1024 * 1024;
+	}
+
+	/**
+	 * Get the profile of the encoded sprites for the current blitter and settings.
+	 * @param blitter_name Name of the current blitter.
+	 * @return The profile.
+	 */
+	static uint64 GetCurrentProfile(const char *blitter_name)
+	{
+		/* FNV-1a */
+		uint64 hash = 0xCBF29CE484222325;
+		auto add_byte = [&](byte value) {
+			hash ^= value;
+			hash *= 0x100000001B3;
+		};
+		for (const char *c = _openttd_revision; *c != '\0'; c++) add_byte(*c);
+		add_byte(0);
+		for (const char *c = blitter_name; *c != '\0'; c++) add_byte(*c);
+		add_byte(0);
+		add_byte(ZOOM_LVL_COUNT);
+		add_byte(_settings_client.gui.zoom_min);
+		add_byte(_settings_client.gui.zoom_max);
+		add_byte(_settings_client.gui.sprite_zoom_min);
+		add_byte(_settings_client.gui.disable_water_animation);
+		return hash;
+	}
+
+	/**
+	 * Open a store file without truncating it, creating it when it does not exist, and lock it.
+	 * @param filename Name of the store file.
+	 * @return The store file, or nullptr if it cannot be opened or is in use by another instance.
+	 */
+	static FILE *OpenLocked(const std::string &filename)
+	{
+#if defined(_WIN32)
+		/* Denying all sharing keeps other instances out while the file is open. */
+		FILE *f = _wfsopen(OTTD2FS(filename).c_str(), L"r+b", _SH_DENYRW);
+		if (f == nullptr && !FileExists(filename)) f = _wfsopen(OTTD2FS(filename).c_str(), L"w+b", _SH_DENYRW);
+		return f;
+#else
+		FILE *f = fopen(filename.c_str(), "r+b");
+		if (f == nullptr) {
+			FILE *created = fopen(filename.c_str(), "ab");
+			if (created == nullptr) return nullptr;
+			fclose(created);
+			f = fopen(filename.c_str(), "r+b");
+			if (f == nullptr) return nullptr;
+		}
+#	if defined(UNIX) && !defined(__EMSCRIPTEN__)
+		if (flock(fileno(f), LOCK_EX | LOCK_NB) != 0) {
+			fclose(f);
+			return nullptr;
+		}
+#	endif
+		return f;
+#endif
+	}
+
+	/**
+	 * Open the store file of a profile, reading its index or starting it over when it is invalid or too large.
+	 * @param profile The profile.
+	 */
+	void Open(uint64 profile)
+	{
+		this->Close();
+		this->open = true;
+		this->profile = profile;
+
+		std::string dir = GetSpriteCacheDirectory("sprites");
+		if (dir.empty()) return;
+		char name[32];
+		seprintf(name, lastof(name), OTTD_PRINTFHEX64PAD ".bin", profile);
+		std::string filename = dir + name;
+
+		this->file = OpenLocked(filename);
+		if (this->file == nullptr) {
+			DEBUG(sprite, 1, "Failed to open encoded sprite store, or it is in use: %s", filename.c_str());
+			return;
+		}
+		if (!this->ReadIndex() || this->file_size > GetMaxSize()) {
+			if (!this->Reset()) return;
+
+			StaleFileRemover remover;
+			remover.keep = filename;
+			remover.Scan(".bin", dir.c_str(), false);
+		}
+		DEBUG(sprite, 2, "Opened encoded sprite store: %s, " PRINTF_SIZE " sprites", filename.c_str(), this->index.size());
+	}
+
+	/**
+	 * Start the open store file over, with no records.
+	 * @return True if the store file can still be used.
+	 */
+	bool Reset()
+	{
+#if defined(UNIX) && !defined(__EMSCRIPTEN__)
+		this->Unmap();
+#endif
+		this->index.clear();
+
+		byte header[HEADER_SIZE];
+		WriteU32(header, MAGIC);
+		WriteU32(header + 4, VERSION);
+		WriteU64(header + 8, this->profile);
+		fflush(this->file);
+#if defined(_WIN32)
+		bool truncated = _chsize_s(_fileno(this->file), 0) == 0;
+#else
+		bool truncated = ftruncate(fileno(this->file), 0) == 0;
+#endif
+		if (!truncated || fseek(this->file, 0, SEEK_SET) != 0 || fwrite(header, HEADER_SIZE, 1, this->file) != 1) {
+			DEBUG(sprite, 1, "Failed to reset encoded sprite store");
+			this->Close();
+			this->open = true;
+			return false;
+		}
+		this->file_size = HEADER_SIZE;
+		this->dirty = true;
+		return true;
+	}
+
+	/**
+	 * Read the index of the open store file.
+	 * @return True if the file is valid.
+	 */
+	bool ReadIndex()
+	{
+		byte header[RECORD_HEADER_SIZE];
+		if (fread(header, HEADER_SIZE, 1, this->file) != 1) return false;
+		if (ReadU32(header) != MAGIC || ReadU32(header + 4) != VERSION || ReadU64(header + 8) != this->profile) return false;
+
+		size_t pos = HEADER_SIZE;
+		for (;;) {
+			size_t read = fread(header, 1, RECORD_HEADER_SIZE, this->file);
+			if (read == 0 && feof(this->file)) break;
+			if (read != RECORD_HEADER_SIZE || ReadU32(header) != RECORD_MAGIC) return false;
+
+			Key key;
+			memcpy(key.md5sum, header + 4, sizeof(key.md5sum));
+			key.file_pos = ReadU64(header + 20);
+			key.type = header[28];
+			uint32 size = ReadU32(header + 32);
+			pos += RECORD_HEADER_SIZE;
+			if (fseek(this->file, size, SEEK_CUR) != 0) return false;
+			this->index[key] = { pos, size, ReadU32(header + 36) };
+			pos += size;
+		}
+
+		/* A truncated last record is caught by the file size check, corrupt data by the checksum when it is loaded. */
+		if (fseek(this->file, 0, SEEK_END) != 0 || (size_t)ftell(this->file) != pos) return false;
+		this->file_size = pos;
+#if defined(UNIX) && !defined(__EMSCRIPTEN__)
+		this->Map();
+#endif
+		return true;
+	}
+
+	/**
+	 * Make sure the store file of the current profile is open.
+	 * @return True if the store file can be used.
+	 */
+	bool Prepare()
+	{
+		uint64 profile = GetCurrentProfile(BlitterFactory::GetCurrentBlitter()->GetName());
+		if (!this->open || this->profile != profile) this->Open(profile);
+		return this->file != nullptr;
+	}
+
+public:
+	~EncodedSpriteStore()
+	{
+		this->Close();
+	}
+
+	/** Close the store file. */
+	void Close()
+	{
+#if defined(UNIX) && !defined(__EMSCRIPTEN__)
+		this->Unmap();
+#endif
+		if (this->file != nullptr) fclose(this->file);
+		this->file = nullptr;
+		this->file_size = 0;
+		this->dirty = false;
+		this->index.clear();
+		this->open = false;
+	}
+
+	/**
+	 * Load a sprite from the store.
+	 * @param sc Sprite to load.
+	 * @param allocator Allocator function to use.
+	 * @return The loaded sprite, or nullptr if the sprite is not in the store.
+	 */
+	void *Load(const SpriteCache *sc, AllocatorProc *allocator)
+	{
+		if (!this->Prepare()) return nullptr;
+
+		auto iter = this->index.find(MakeKey(sc));
+		if (iter == this->index.end()) return nullptr;
+		const Location loc = iter->second;
+
+		if (this->dirty) {
+			fflush(this->file);
+			this->dirty = false;
+		}
+
+		/* The data is checked before anything is allocated, as the allocation has to be used. */
+		const byte *data = nullptr;
+		std::unique_ptr<byte[]> buffer;
+#if defined(UNIX) && !defined(__EMSCRIPTEN__)
+		if (loc.offset + loc.size > this->map_size) this->Map();
+		if (loc.offset + loc.size <= this->map_size) data = this->map_ptr + loc.offset;
+#endif
+		if (data == nullptr) {
+			buffer.reset(new byte[loc.size]);
+			if (fseek(this->file, loc.offset, SEEK_SET) != 0 || fread(buffer.get(), loc.size, 1, this->file) != 1) {
+				/* The file is not readable, stop using it. */
+				this->Close();
+				this->open = true;
+				return nullptr;
+			}
+			data = buffer.get();
+		}
+		if (GetChecksum(data, loc.size) != loc.checksum) {
+			DEBUG(sprite, 1, "Corrupt sprite in encoded sprite store, ignoring it");
+			this->index.erase(iter);
+			return nullptr;
+		}
+
+		byte *dest = (byte *)allocator(loc.size);
+		memcpy(dest, data, loc.size);
+		return dest;
+	}
+
+	/**
+	 * Add an encoded sprite to the store.
+	 * @param sc Sprite to add.
+	 * @param data Encoded sprite data.
+	 * @param size Size of the encoded sprite data.
+	 */
+	void Add(const SpriteCache *sc, const void *data, uint32 size)
+	{
+		if (!this->Prepare()) return;
+		if (HEADER_SIZE + RECORD_HEADER_SIZE + size > GetMaxSize()) return;
+
+		Key key = MakeKey(sc);
+		if (this->index.find(key) != this->index.end()) return;
+
+		/* When the store is full it is started over, so that it follows the sprites which are in use. */
+		if (this->file_size + RECORD_HEADER_SIZE + size > GetMaxSize() && !this->Reset()) return;
+
+		const uint32 checksum = GetChecksum((const byte *)data, size);
+		byte header[RECORD_HEADER_SIZE] = {};
+		WriteU32(header, RECORD_MAGIC);
+		memcpy(header + 4, key.md5sum, sizeof(key.md5sum));
+		WriteU64(header + 20, key.file_pos);
+		header[28] = key.type;
+		WriteU32(header + 32, size);
+		WriteU32(header + 36, checksum);
+
+		if (fseek(this->file, this->file_size, SEEK_SET) != 0 || fwrite(header, RECORD_HEADER_SIZE, 1, this->file) != 1 || fwrite(data, size, 1, this->file) != 1) {
+			DEBUG(sprite, 1, "Failed to write to encoded sprite store");
+			this->Close();
+			this->open = true;
+			return;
+		}
+		this->index[key] = { this->file_size + RECORD_HEADER_SIZE, size, checksum };
+		this->file_size += RECORD_HEADER_SIZE + size;
+		this->dirty = true;
+	}
+
+	/**
+	 * Check whether a sprite may be kept in the store.
+	 * @param sc Sprite to check.
+	 * @return True if the sprite has an identifiable origin.
+	 */
+	static bool IsStorable(const SpriteCache *sc)
+	{
+		/* Font sprites depend on the font zoom, which can change at any time. */
+		if (_sprite_disk_cache_size == 0 || sc->GetType() == ST_MAPGEN || sc->GetType() == ST_FONT) return false;
+		static const uint8 zero_md5[16] = {};
+		return memcmp(sc->file->md5sum, zero_md5, sizeof(zero_md5)) != 0;
+	}
+};
+
+static EncodedSpriteStore _encoded_sprite_store;
+
 /**
  * Read a sprite from disk.
  * @param sc          Location of sprite.
@@ -506,6 +964,9 @@ static void *ReadRecolourSprite(SpriteFile &file, uint num)
  */
 static void *ReadSprite(const SpriteCache *sc, SpriteID id, SpriteType sprite_type, AllocatorProc *allocator, SpriteEncoder *encoder)
 {
+	/* Only sprites encoded for the sprite cache are kept in the encoded sprite store. */
+	const bool storable = encoder == nullptr && allocator == AllocSprite && EncodedSpriteStore::IsStorable(sc);
+
 	/* Use current blitter if no other sprite encoder is given. */
 	if (encoder == nullptr) encoder = BlitterFactory::GetCurrentBlitter();
 
@@ -582,7 +1043,9 @@ static void *ReadSprite(const SpriteCache *sc, SpriteID id, SpriteType sprite_ty
 		sprite[ZOOM_LVL_NORMAL].colours = sprite[ZOOM_LVL_FONT].colours;
 	}
 
-	return encoder->Encode(sprite, allocator);
+	Sprite *encoded = encoder->Encode(sprite, allocator);
+	if (storable) _encoded_sprite_store.Add(sc, encoded, _last_sprite_allocation.GetSize());
+	return encoded;
 }
 
 struct GrfSpriteOffset {
@@ -605,6 +1068,317 @@ size_t GetGRFSpriteOffset(uint32 id)
 	return iter != _grf_sprite_offsets.end() ? iter->second.file_pos : SIZE_MAX;
 }
 
+/**
+ * Index of the structure of a GRF file. It allows stepping over real sprites
+ * in the data section without parsing the sprite data again. It depends on the
+ * file content and on where the content begins in the opened file, which differs
+ * for files in tars, so it is cached keyed by the MD5 checksum of the file and
+ * the position of its content.
+ * Only container version 1 files are indexed, in later versions the sprite data
+ * is in the sprite section and real sprites in the data section are skipped at once.
+ */
+struct GRFSpriteIndex {
+	/** A real sprite in the data section. */
+	struct SkipEntry {
+		uint32 pos;      ///< File position of the sprite header.
+		uint32 num;      ///< Size field of the sprite header.
+		uint32 next_pos; ///< File position just after the sprite.
+	};
+
+	std::vector<SkipEntry> skip_entries; ///< Real sprites in the data section, sorted by position.
+};
+
+/** Version of the on-disk GRF sprite index format. */
+static const uint32 GRF_SPRITE_INDEX_VERSION = 2;
+/** Magic at the start of an on-disk GRF sprite index. */
+static const uint32 GRF_SPRITE_INDEX_MAGIC = 'O' | ('G' << 8) | ('S' << 16) | ('I' << 24);
+/** Size of the header of an on-disk GRF sprite index: magic, version, container version, file size, content begin and entry count. */
+static const size_t GRF_SPRITE_INDEX_HEADER_SIZE = 24;
+/** Size of a skip entry of an on-disk GRF sprite index. */
+static const size_t GRF_SPRITE_INDEX_ENTRY_SIZE = 12;
+
+/** Sprite indices used while loading NewGRFs, by MD5 checksum of the file and position of its content, see GetGRFSpriteIndexKey. */
+static std::map<std::string, std::unique_ptr<GRFSpriteIndex>> _grf_sprite_index_cache;
+
+/**
+ * Build the sprite index of a GRF by walking the whole file.
+ * @param file GRF to index, its position is restored afterwards.
+ * @param index Index to fill.
+ * @return True if the file could be indexed.
+ */
+static bool BuildGRFSpriteIndex(SpriteFile &file, GRFSpriteIndex &index)
+{
+	assert(file.GetContainerVersion() == 1);
+
+	size_t old_pos = file.GetPos();
+	file.SeekToBegin();
+
+	bool ok = true;
+	for (;;) {
+		size_t pos = file.GetPos();
+		uint32 num = file.ReadWord();
+		if (num == 0) break;
+		byte type = file.ReadByte();
+		if (type == 0xFF) {
+			file.SkipBytes(num);
+			continue;
+		}
+		file.SkipBytes(7);
+		if (!SkipSpriteData(file, type, num - 8)) {
+			ok = false;
+			break;
+		}
+		index.skip_entries.push_back({ (uint32)pos, num, (uint32)file.GetPos() });
+	}
+
+	file.SeekTo(old_pos, SEEK_SET);
+	return ok;
+}
+
+/**
+ * Get the name of the on-disk sprite index of a GRF.
+ * @param key Key of the GRF, see GetGRFSpriteIndexKey.
+ * @return The file name, or an empty string if there is no cache directory.
+ */
+static std::string GetGRFSpriteIndexFilename(const std::string &key)
+{
+	std::string dir = GetSpriteCacheDirectory("grf");
+	if (dir.empty()) return dir;
+	return dir + key + ".idx";
+}
+
+/**
+ * Load a sprite index from the on-disk cache.
+ * @param file GRF the index is for, to check that the index matches it.
+ * @param key Key of the GRF, see GetGRFSpriteIndexKey.
+ * @param index Index to fill.
+ * @return True if a valid index was loaded.
+ */
+static bool LoadGRFSpriteIndex(SpriteFile &file, const std::string &key, GRFSpriteIndex &index)
+{
+	std::string filename = GetGRFSpriteIndexFilename(key);
+	if (filename.empty()) return false;
+
+	size_t size;
+	std::unique_ptr<FILE, FileDeleter> f(FioFOpenFile(filename, "rb", NO_DIRECTORY, &size));
+	if (f == nullptr || size < GRF_SPRITE_INDEX_HEADER_SIZE) return false;
+
+	std::vector<byte> buffer(size);
+	if (fread(buffer.data(), size, 1, f.get()) != 1) return false;
+	f.reset();
+
+	const byte *pos = buffer.data();
+	auto read_u32 = [&]() -> uint32 {
+		uint32 value = pos[0] | (pos[1] << 8) | (pos[2] << 16) | ((uint32)pos[3] << 24);
+		pos += 4;
+		return value;
+	};
+
+	if (read_u32() != GRF_SPRITE_INDEX_MAGIC || read_u32() != GRF_SPRITE_INDEX_VERSION) return false;
+	if (read_u32() != file.GetContainerVersion() || read_u32() != file.GetSize() || read_u32() != file.GetContentBegin()) return false;
+	uint32 skip_count = read_u32();
+	if ((size - GRF_SPRITE_INDEX_HEADER_SIZE) / GRF_SPRITE_INDEX_ENTRY_SIZE != skip_count ||
+			(size - GRF_SPRITE_INDEX_HEADER_SIZE) % GRF_SPRITE_INDEX_ENTRY_SIZE != 0) {
+		return false;
+	}
+
+	index.skip_entries.resize(skip_count);
+	for (GRFSpriteIndex::SkipEntry &entry : index.skip_entries) {
+		entry.pos = read_u32();
+		entry.num = read_u32();
+		entry.next_pos = read_u32();
+	}
+	return true;
+}
+
+/**
+ * Save a sprite index to the on-disk cache.
+ * @param file GRF the index is for.
+ * @param key Key of the GRF, see GetGRFSpriteIndexKey.
+ * @param index Index to save.
+ */
+static void SaveGRFSpriteIndex(SpriteFile &file, const std::string &key, const GRFSpriteIndex &index)
+{
+	std::string filename = GetGRFSpriteIndexFilename(key);
+	if (filename.empty()) return;
+
+	std::string tmp_filename = filename + ".tmp";
+	FILE *f = fopen(tmp_filename.c_str(), "wb");
+	if (f == nullptr) return;
+
+	std::vector<byte> buffer;
+	buffer.reserve(GRF_SPRITE_INDEX_HEADER_SIZE + index.skip_entries.size() * GRF_SPRITE_INDEX_ENTRY_SIZE);
+	auto write_u32 = [&](uint32 value) {
+		buffer.push_back(GB(value, 0, 8));
+		buffer.push_back(GB(value, 8, 8));
+		buffer.push_back(GB(value, 16, 8));
+		buffer.push_back(GB(value, 24, 8));
+	};
+
+	write_u32(GRF_SPRITE_INDEX_MAGIC);
+	write_u32(GRF_SPRITE_INDEX_VERSION);
+	write_u32(file.GetContainerVersion());
+	write_u32((uint32)file.GetSize());
+	write_u32((uint32)file.GetContentBegin());
+	write_u32((uint32)index.skip_entries.size());
+	for (const GRFSpriteIndex::SkipEntry &entry : index.skip_entries) {
+		write_u32(entry.pos);
+		write_u32(entry.num);
+		write_u32(entry.next_pos);
+	}
+
+	bool ok = fwrite(buffer.data(), buffer.size(), 1, f) == 1;
+	ok &= fclose(f) == 0;
+	if (!ok || rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+		remove(tmp_filename.c_str());
+		DEBUG(sprite, 1, "Failed to write GRF sprite index cache: %s", filename.c_str());
+	}
+}
+
+/**
+ * Get the key of a GRF in the sprite index cache.
+ * @param file GRF to get the key of.
+ * @param md5sum MD5 checksum of the GRF.
+ * @return Hex MD5 checksum and position of the content, or an empty string if the checksum is unknown.
+ */
+static std::string GetGRFSpriteIndexKey(const SpriteFile &file, const uint8 *md5sum)
+{
+	static const uint8 zero_md5[16] = {};
+	if (memcmp(md5sum, zero_md5, 16) == 0) return std::string();
+
+	char md5_buf[33];
+	md5sumToString(md5_buf, lastof(md5_buf), md5sum);
+	return stdstr_fmt("%s-%X", md5_buf, (uint)file.GetContentBegin());
+}
+
+/**
+ * Get the sprite index of a GRF from the on-disk cache or by building it.
+ * This only touches the given file, so may be called from a worker thread.
+ * @param file GRF to index.
+ * @param key Key of the GRF, see GetGRFSpriteIndexKey.
+ * @param[out] built Set when the index was built and should be saved to the on-disk cache.
+ * @return The sprite index, empty if the file could not be indexed.
+ */
+static std::unique_ptr<GRFSpriteIndex> ObtainGRFSpriteIndex(SpriteFile &file, const std::string &key, bool &built)
+{
+	built = false;
+	std::unique_ptr<GRFSpriteIndex> index(new GRFSpriteIndex());
+	if (LoadGRFSpriteIndex(file, key, *index)) return index;
+
+	index.reset(new GRFSpriteIndex());
+	if (BuildGRFSpriteIndex(file, *index)) {
+		built = true;
+	} else {
+		index.reset(new GRFSpriteIndex());
+	}
+	return index;
+}
+
+/**
+ * Prepare the sprite indices of several GRFs at once, using a pool of worker threads.
+ * Each worker only reads its own file, the results are merged afterwards in the order of the list.
+ * Only GRFs of container version 1 are indexed.
+ * @param files GRFs to index, with their MD5 checksums.
+ */
+void PrepareGRFSpriteIndices(const std::vector<std::pair<SpriteFile *, const uint8 *>> &files)
+{
+	struct Job {
+		SpriteFile *file;
+		std::string key;
+		std::unique_ptr<GRFSpriteIndex> index;
+		bool built;
+	};
+	std::vector<Job> jobs;
+	for (const auto &it : files) {
+		if (it.first->GetContainerVersion() != 1) continue;
+		std::string key = GetGRFSpriteIndexKey(*it.first, it.second);
+		if (key.empty() || _grf_sprite_index_cache.count(key) > 0) continue;
+		if (std::any_of(jobs.begin(), jobs.end(), [&](const Job &job) { return job.key == key || job.file == it.first; })) continue;
+		jobs.push_back({ it.first, std::move(key), nullptr, false });
+	}
+	if (jobs.empty()) return;
+
+	std::atomic<size_t> next_job(0);
+	auto worker = [&]() {
+		size_t i;
+		while ((i = next_job++) < jobs.size()) {
+			Job &job = jobs[i];
+			job.index = ObtainGRFSpriteIndex(*job.file, job.key, job.built);
+		}
+	};
+
+	uint parallel = std::thread::hardware_concurrency();
+	if (parallel <= 1) parallel = 0;
+
+	std::vector<std::thread> threads;
+	for (uint i = 0; i < std::min<uint>(parallel, (uint)jobs.size()); i++) {
+		std::thread thread;
+		if (!StartNewThread(&thread, "ottd:grf-index", [&]() { worker(); })) break;
+		threads.push_back(std::move(thread));
+	}
+	/* No threads available, index the files on this thread instead. */
+	if (threads.empty()) worker();
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+
+	for (Job &job : jobs) {
+		if (job.built) SaveGRFSpriteIndex(*job.file, job.key, *job.index);
+		_grf_sprite_index_cache[job.key] = std::move(job.index);
+	}
+}
+
+/**
+ * Get the sprite index to be used for a GRF which is about to be loaded.
+ * The index is taken from memory, the on-disk cache, or built and cached.
+ * Only GRFs of container version 1 are indexed.
+ * @param file GRF about to be loaded.
+ * @param md5sum MD5 checksum of the GRF, all zeros if unknown.
+ * @return The sprite index, valid until ClearGRFSpriteIndexCache is called, or nullptr if the GRF isn't indexed.
+ */
+const GRFSpriteIndex *GetGRFSpriteIndex(SpriteFile &file, const uint8 *md5sum)
+{
+	if (file.GetContainerVersion() != 1) return nullptr;
+
+	std::string key = GetGRFSpriteIndexKey(file, md5sum);
+	if (key.empty()) return nullptr;
+
+	std::unique_ptr<GRFSpriteIndex> &index = _grf_sprite_index_cache[key];
+	if (index == nullptr) {
+		bool built;
+		index = ObtainGRFSpriteIndex(file, key, built);
+		if (built) SaveGRFSpriteIndex(file, key, *index);
+	}
+	return index.get();
+}
+
+/**
+ * Forget all sprite indices kept in memory, after loading NewGRFs has finished.
+ */
+void ClearGRFSpriteIndexCache()
+{
+	_grf_sprite_index_cache.clear();
+}
+
+/**
+ * Look up a real sprite in the data section of a GRF in its sprite index.
+ * @param index Sprite index of the GRF, may be nullptr.
+ * @param pos File position of the sprite header.
+ * @param num Size field read from the sprite header, to validate the index entry.
+ * @return File position just after the sprite, or 0 if the sprite isn't indexed.
+ */
+size_t GetGRFSpriteIndexPosAfterSprite(const GRFSpriteIndex *index, size_t pos, uint32 num)
+{
+	if (index == nullptr) return 0;
+
+	const auto &entries = index->skip_entries;
+	auto it = std::lower_bound(entries.begin(), entries.end(), pos, [](const GRFSpriteIndex::SkipEntry &entry, size_t pos) {
+		return entry.pos < pos;
+	});
+	if (it == entries.end() || it->pos != pos || it->num != num) return 0;
+	return it->next_pos;
+}
+
 /**
  * Parse the sprite section of GRFs.
  * @param container_version Container version of the GRF we're currently processing.
@@ -944,7 +1718,8 @@ void *GetRawSprite(SpriteID sprite, SpriteType type, AllocatorProc *allocator, S
 
 		/* Load the sprite, if it is not loaded, yet */
 		if (sc->GetPtr() == nullptr) {
-			void *ptr = ReadSprite(sc, sprite, type, AllocSprite, nullptr);
+			void *ptr = EncodedSpriteStore::IsStorable(sc) ? _encoded_sprite_store.Load(sc, AllocSprite) : nullptr;
+			if (ptr == nullptr) ptr = ReadSprite(sc, sprite, type, AllocSprite, nullptr);
 			assert(ptr == _last_sprite_allocation.GetPtr());
 			sc->buffer = std::move(_last_sprite_allocation);
 		}
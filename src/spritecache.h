@@ -13,6 +13,8 @@
 #include "gfx_type.h"
 #include "spriteloader/spriteloader.hpp"
 
+#include <vector>
+
 /** Data structure describing a sprite. */
 struct Sprite {
 	uint16 height; ///< Height of the sprite.
@@ -23,6 +25,7 @@ struct Sprite {
 };
 
 extern uint _sprite_cache_size;
+extern uint _sprite_disk_cache_size;
 
 typedef void *AllocatorProc(size_t size);
 
@@ -55,7 +58,13 @@ void IncreaseSpriteLRU();
 
 SpriteFile &OpenCachedSpriteFile(const std::string &filename, Subdirectory subdir, bool palette_remap);
 
+struct GRFSpriteIndex;
+
 void ReadGRFSpriteOffsets(SpriteFile &file);
+void PrepareGRFSpriteIndices(const std::vector<std::pair<SpriteFile *, const uint8 *>> &files);
+const GRFSpriteIndex *GetGRFSpriteIndex(SpriteFile &file, const uint8 *md5sum);
+void ClearGRFSpriteIndexCache();
+size_t GetGRFSpriteIndexPosAfterSprite(const GRFSpriteIndex *index, size_t pos, uint32 num);
 size_t GetGRFSpriteOffset(uint32 id);
 bool LoadNextSprite(int load_index, SpriteFile &file, uint file_sprite_id);
 bool SkipSpriteData(SpriteFile &file, byte type, uint16 num);
@@ -31,6 +31,7 @@ class SpriteFile : public RandomAccessFile {
 
 public:
 	SpriteFileFlags flags = SFF_NONE;
+	uint8 md5sum[16] = {}; ///< MD5 checksum of the file, all zeros if unknown.
 
 	SpriteFile(const std::string &filename, Subdirectory subdir, bool palette_remap);
 	SpriteFile(const SpriteFile&) = delete;
@@ -48,6 +49,12 @@ public:
 	 */
 	byte GetContainerVersion() const { return this->container_version; }
 
+	/**
+	 * Get the position of the begin of the content, i.e. the position just after the container version has been determined.
+	 * @return The position.
+	 */
+	size_t GetContentBegin() const { return this->content_begin; }
+
 	/**
 	 * Seek to the begin of the content, i.e. the position just after the container version has been determined.
 	 */
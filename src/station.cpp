@@ -45,6 +45,13 @@ uint8 _extra_station_names_probability;
 
 StationKdtree _station_kdtree(Kdtree_StationXYFunc);
 
+/**
+ * Index of the stations covering each tile with their catchment area. Each entry
+ * holds the tile in the upper bits and the station ID in the lower 16 bits, so
+ * the stations covering a tile are adjacent and ordered by station ID.
+ */
+static btree::btree_set<uint64> _station_catchment_index;
+
 void RebuildStationKdtree()
 {
 	std::vector<StationID> stids;
@@ -98,13 +105,21 @@ Station::~Station()
 		for (CargoID c = 0; c < NUM_CARGO; c++) {
 			this->goods[c].cargo.OnCleanPool();
 		}
+		_station_catchment_index.clear();
 		return;
 	}
 
+	this->UpdateCatchmentIndex(false);
+
 	while (!this->loading_vehicles.empty()) {
 		this->loading_vehicles.front()->LeaveStation();
 	}
 
+	for (RoadVehicle *rv : this->road_waiting_vehicles) {
+		rv->route_hold_tile = INVALID_TILE;
+		rv->route_hold_station = INVALID_STATION;
+	}
+
 	for (Aircraft *a : Aircraft::Iterate()) {
 		if (!a->IsNormalAircraft()) continue;
 		if (a->targetairport == this->index) a->targetairport = INVALID_STATION;
@@ -233,6 +248,20 @@ RoadStop *Station::GetPrimaryRoadStop(const RoadVehicle *v) const
 	return rs;
 }
 
+/**
+ * Called when a bay, entrance or drive-through lane reservation of one of the road stops of this station changes.
+ * Road vehicles queueing for this station have held their last route choice since the previous change,
+ * release them so that they choose again with the new occupancy.
+ */
+void Station::RoadStopReservationChanged()
+{
+	for (RoadVehicle *rv : this->road_waiting_vehicles) {
+		rv->route_hold_tile = INVALID_TILE;
+		rv->route_hold_station = INVALID_STATION;
+	}
+	this->road_waiting_vehicles.clear();
+}
+
 /**
  * Called when new facility is built on the station. If it is the first facility
  * it initializes also 'xy' and 'random_bits' members
@@ -459,6 +488,65 @@ void Station::RemoveFromAllNearbyLists()
 	for (Industry *i : Industry::Iterate()) { i->stations_near.erase(this); }
 }
 
+static inline uint64 GetStationCatchmentIndexKey(TileIndex tile, StationID station)
+{
+	return ((uint64)tile << 16) | station;
+}
+
+/**
+ * Add or remove all tiles of our catchment area to or from the station catchment index.
+ * @param add True to add the tiles, false to remove them.
+ */
+void Station::UpdateCatchmentIndex(bool add) const
+{
+	if (this->catchment_tiles.tile == INVALID_TILE) return;
+
+	BitmapTileIterator it(this->catchment_tiles);
+	for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
+		if (add) {
+			_station_catchment_index.insert(GetStationCatchmentIndexKey(tile, this->index));
+		} else {
+			_station_catchment_index.erase(GetStationCatchmentIndexKey(tile, this->index));
+		}
+	}
+}
+
+/**
+ * Add the stations of a candidate list whose catchment area covers a tile to a station list.
+ * This is equivalent to testing TileIsInCatchment of each candidate, but only
+ * needs a lookup in the station catchment index.
+ * @param tile Tile to test.
+ * @param candidates Stations to consider.
+ * @param stations List to add the stations covering the tile to.
+ */
+void AddStationsCoveringTile(TileIndex tile, const StationList &candidates, StationList &stations)
+{
+	if (candidates.empty()) return;
+
+	for (auto it = _station_catchment_index.lower_bound(GetStationCatchmentIndexKey(tile, 0)); it != _station_catchment_index.end() && (*it >> 16) == tile; ++it) {
+		Station *st = Station::Get((StationID)GB(*it, 0, 16));
+		if (candidates.find(st) != candidates.end()) stations.insert(st);
+	}
+}
+
+/**
+ * Check whether the station catchment index matches the catchment areas of all stations.
+ * @return True if the index is valid.
+ */
+bool IsStationCatchmentIndexValid()
+{
+	size_t count = 0;
+	for (const Station *st : Station::Iterate()) {
+		if (st->catchment_tiles.tile == INVALID_TILE) continue;
+		BitmapTileIterator it(st->catchment_tiles);
+		for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
+			if (_station_catchment_index.count(GetStationCatchmentIndexKey(tile, st->index)) == 0) return false;
+			count++;
+		}
+	}
+	return count == _station_catchment_index.size();
+}
+
 /**
  * Test if the given town ID is covered by our catchment area.
  * This is used when removing a house tile to determine if it was the last house tile
@@ -483,6 +571,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 {
 	this->industries_near.clear();
 	if (!no_clear_nearby_lists) this->RemoveFromAllNearbyLists();
+	this->UpdateCatchmentIndex(false);
 
 	if (this->rect.IsEmpty()) {
 		this->catchment_tiles.Reset();
@@ -512,6 +601,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 			if (!IsTileType(tile, MP_STATION) || GetStationIndex(tile) != this->index) continue;
 			this->station_tiles++;
 		}
+		this->UpdateCatchmentIndex(true);
 		return;
 	}
 
@@ -532,6 +622,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 		TileArea ta2 = TileArea(tile, 1, 1).Expand(r);
 		for (TileIndex tile2 : ta2) this->catchment_tiles.SetTile(tile2);
 	}
+	this->UpdateCatchmentIndex(true);
 
 	/* Search catchment tiles for towns and industries */
 	BitmapTileIterator it(this->catchment_tiles);
@@ -831,6 +831,7 @@ public:
 	byte time_since_unload;
 
 	std::vector<Vehicle *> loading_vehicles;
+	std::vector<RoadVehicle *> road_waiting_vehicles; ///< NOSAVE: Road vehicles queueing for this station with a held route choice, in no particular order
 	GoodsEntry goods[NUM_CARGO];  ///< Goods at this station
 	CargoTypes always_accepted;       ///< Bitmask of always accepted cargo types (by houses, HQs, industry tiles when industry doesn't accept cargo)
 
@@ -845,12 +846,13 @@ public:
 	~Station();
 
 	void AddFacility(StationFacility new_facility_bit, TileIndex facil_xy);
+	void RoadStopReservationChanged();
 
 	void MarkTilesDirty(bool cargo_change) const;
 
 	void UpdateVirtCoord() override;
 
-	void UpdateCargoHistory();
+	bool UpdateCargoHistory();
 
 	void MoveSign(TileIndex new_xy) override;
 
@@ -872,6 +874,7 @@ public:
 	void AddIndustryToDeliver(Industry *ind, TileIndex tile);
 	void RemoveIndustryToDeliver(Industry *ind);
 	void RemoveFromAllNearbyLists();
+	void UpdateCatchmentIndex(bool add) const;
 
 	inline bool TileIsInCatchment(TileIndex tile) const
 	{
@@ -931,6 +934,8 @@ public:
 };
 
 void RebuildStationKdtree();
+void AddStationsCoveringTile(TileIndex tile, const StationList &candidates, StationList &stations);
+bool IsStationCatchmentIndexValid();
 
 /**
  * Call a function on all stations that have any part of the requested area within their catchment.
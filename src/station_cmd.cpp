@@ -59,6 +59,7 @@
 #include "tunnelbridge_map.h"
 #include "cheat_type.h"
 #include "newgrf_roadstop.h"
+#include "thread.h"
 
 #include "table/strings.h"
 
@@ -458,8 +459,10 @@ void Station::GetTileArea(TileArea *ta, StationType type) const
 
 /**
  * Update the cargo history.
+ * This does not invalidate any windows, so it may be run on a worker thread.
+ * @return true if the station view window needs its data invalidating.
  */
-void Station::UpdateCargoHistory()
+bool Station::UpdateCargoHistory()
 {
 	uint storage_offset = 0;
 	bool update_window = false;
@@ -480,7 +483,7 @@ void Station::UpdateCargoHistory()
 	}
 	this->station_cargo_history_offset++;
 	if (this->station_cargo_history_offset == MAX_STATION_CARGO_HISTORY_DAYS) this->station_cargo_history_offset = 0;
-	if (update_window) InvalidateWindowData(WC_STATION_VIEW, this->index, -1);
+	return update_window;
 }
 
 /**
@@ -4333,49 +4336,50 @@ static void UpdateStationRating(Station *st)
 
 /**
  * Reroute cargo of type c at station st or in any vehicles unloading there.
- * Make sure the cargo's new next hop is neither "avoid" nor "avoid2".
+ * Make sure the cargo's new next hop is neither one of "avoid" nor "avoid2".
+ * All stations are handled in a single pass over the vehicles loading there.
  * @param st Station to be rerouted at.
  * @param c Type of cargo.
- * @param avoid Original next hop of cargo, avoid this.
+ * @param avoid Original next hops of cargo, avoid these.
  * @param avoid2 Another station to be avoided when rerouting.
  */
-void RerouteCargo(Station *st, CargoID c, StationID avoid, StationID avoid2)
+void RerouteCargo(Station *st, CargoID c, span<const StationID> avoid, StationID avoid2)
 {
 	GoodsEntry &ge = st->goods[c];
 
 	/* Reroute cargo in station. */
-	ge.cargo.Reroute(UINT_MAX, &ge.cargo, avoid, avoid2, &ge);
+	ge.cargo.BulkReroute(avoid, avoid2, &ge);
 
 	/* Reroute cargo staged to be transferred. */
 	for (Vehicle *v : st->loading_vehicles) {
 		for (; v != nullptr; v = v->Next()) {
 			if (v->cargo_type != c) continue;
-			v->cargo.Reroute(UINT_MAX, &v->cargo, avoid, avoid2, &ge);
+			v->cargo.RerouteStaged(avoid, avoid2, &ge);
 		}
 	}
 }
 
 /**
  * Reroute cargo of type c from source at station st or in any vehicles unloading there.
- * Make sure the cargo's new next hop is neither "avoid" nor "avoid2".
+ * Make sure the cargo's new next hop is neither one of "avoid" nor "avoid2".
  * @param st Station to be rerouted at.
  * @param c Type of cargo.
  * @param source Source station.
- * @param avoid Original next hop of cargo, avoid this.
+ * @param avoid Original next hops of cargo, avoid these.
  * @param avoid2 Another station to be avoided when rerouting.
  */
-void RerouteCargoFromSource(Station *st, CargoID c, StationID source, StationID avoid, StationID avoid2)
+void RerouteCargoFromSource(Station *st, CargoID c, StationID source, span<const StationID> avoid, StationID avoid2)
 {
 	GoodsEntry &ge = st->goods[c];
 
 	/* Reroute cargo in station. */
-	ge.cargo.RerouteFromSource(UINT_MAX, &ge.cargo, source, avoid, avoid2, &ge);
+	ge.cargo.BulkRerouteFromSource(source, avoid, avoid2, &ge);
 
 	/* Reroute cargo staged to be transferred. */
 	for (Vehicle *v : st->loading_vehicles) {
 		for (; v != nullptr; v = v->Next()) {
 			if (v->cargo_type != c) continue;
-			v->cargo.RerouteFromSource(UINT_MAX, &v->cargo, source, avoid, avoid2, &ge);
+			v->cargo.RerouteStagedFromSource(source, avoid, avoid2, &ge);
 		}
 	}
 }
@@ -4403,6 +4407,7 @@ void DeleteStaleLinks(Station *from)
 		LinkGraph *lg = LinkGraph::GetIfValid(ge.link_graph);
 		if (lg == nullptr) continue;
 		Node node = (*lg)[ge.node];
+		std::vector<StationID> reroute;
 		for (EdgeIterator it(node.Begin()); it != node.End();) {
 			Edge edge = it->second;
 			Station *to = Station::Get((*lg)[it->first].Station());
@@ -4471,16 +4476,18 @@ void DeleteStaleLinks(Station *from)
 					/* If it's still considered dead remove it. */
 					node.RemoveEdge(to->goods[c].node);
 					ge.flows.DeleteFlows(to->index);
-					RerouteCargo(from, c, to->index, from->index);
+					reroute.push_back(to->index);
 				}
 			} else if (edge.LastUnrestrictedUpdate() != INVALID_DATE && (uint)(_date - edge.LastUnrestrictedUpdate()) > timeout) {
 				edge.Restrict();
 				ge.flows.RestrictFlows(to->index);
-				RerouteCargo(from, c, to->index, from->index);
+				reroute.push_back(to->index);
 			} else if (edge.LastRestrictedUpdate() != INVALID_DATE && (uint)(_date - edge.LastRestrictedUpdate()) > timeout) {
 				edge.Release();
 			}
 		}
+		/* Reroute after all stale links have been removed, so that cargo isn't sent to another link which is about to be removed. */
+		if (!reroute.empty()) RerouteCargo(from, c, reroute, from->index);
 		assert(_date >= lg->LastCompression());
 		if ((uint)(_date - lg->LastCompression()) > std::max<uint>(LinkGraph::COMPRESSION_INTERVAL / _settings_game.economy.day_length_factor, 1)) {
 			lg->Compress();
@@ -4595,8 +4602,16 @@ void StationDailyLoop()
 {
 	// Only record cargo history every second day.
 	if (_date % 2 != 0) {
-		for (Station *st : Station::Iterate()) {
-			st->UpdateCargoHistory();
+		std::vector<Station *> stations;
+		stations.reserve(Station::GetNumItems());
+		for (Station *st : Station::Iterate()) stations.push_back(st);
+
+		std::unique_ptr<bool[]> update_window(new bool[stations.size()]);
+		RunParallelJobs(stations.size(), 512, [&](size_t idx) {
+			update_window[idx] = stations[idx]->UpdateCargoHistory();
+		});
+		for (size_t idx = 0; idx < stations.size(); idx++) {
+			if (update_window[idx]) InvalidateWindowData(WC_STATION_VIEW, stations[idx]->index, -1);
 		}
 		InvalidateWindowClassesData(WC_STATION_CARGO);
 	}
@@ -4756,13 +4771,6 @@ CommandCost CmdSetStationCargoAllowedSupply(TileIndex tile, DoCommandFlag flags,
 	return CommandCost();
 }
 
-static void AddNearbyStationsByCatchment(TileIndex tile, StationList *stations, StationList &nearby)
-{
-	for (Station *st : nearby) {
-		if (st->TileIsInCatchment(tile)) stations->insert(st);
-	}
-}
-
 /**
  * Run a tile loop to find stations around a tile, on demand. Cache the result for further requests
  * @return pointer to a StationList containing all stations found
@@ -4773,7 +4781,7 @@ const StationList *StationFinder::GetStations()
 		if (IsTileType(this->tile, MP_HOUSE)) {
 			/* Town nearby stations need to be filtered per tile. */
 			assert(this->w == 1 && this->h == 1);
-			AddNearbyStationsByCatchment(this->tile, &this->stations, Town::GetByTile(this->tile)->stations_near);
+			AddStationsCoveringTile(this->tile, Town::GetByTile(this->tile)->stations_near, this->stations);
 		} else {
 			ForAllStationsAroundTiles(*this, [this](Station *st, TileIndex tile) {
 				this->stations.insert(st);
@@ -19,6 +19,7 @@
 #include "road.h"
 #include "linkgraph/linkgraph_type.h"
 #include "industry_type.h"
+#include "core/span_type.hpp"
 
 void ModifyStationRatingAround(TileIndex tile, Owner owner, int amount, uint radius);
 
@@ -54,8 +55,13 @@ bool SplitGroundSpriteForOverlay(const TileInfo *ti, SpriteID *ground, RailTrack
 
 void IncreaseStats(Station *st, const Vehicle *v, StationID next_station_id);
 void IncreaseStats(Station *st, CargoID cargo, StationID next_station_id, uint capacity, uint usage, EdgeUpdateMode mode);
-void RerouteCargo(Station *st, CargoID c, StationID avoid, StationID avoid2);
-void RerouteCargoFromSource(Station *st, CargoID c, StationID source, StationID avoid, StationID avoid2);
+void RerouteCargo(Station *st, CargoID c, span<const StationID> avoid, StationID avoid2);
+void RerouteCargoFromSource(Station *st, CargoID c, StationID source, span<const StationID> avoid, StationID avoid2);
+
+inline void RerouteCargo(Station *st, CargoID c, StationID avoid, StationID avoid2)
+{
+	RerouteCargo(st, c, span<const StationID>(&avoid, 1), avoid2);
+}
 
 /**
  * Calculates the maintenance cost of a number of station tiles.
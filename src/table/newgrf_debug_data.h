@@ -299,6 +299,11 @@ class NIHVehicle : public NIHelper {
 			seprintf(buffer, lastof(buffer), "  Speed: %u, path cache length: %u",
 					rv->cur_speed, (uint) rv->path.size());
 			output.print(buffer);
+			if (rv->route_hold_tile != INVALID_TILE) {
+				seprintf(buffer, lastof(buffer), "  Route choice held: tile: %X (%u x %u), trackdir: %u, station: %u",
+						rv->route_hold_tile, TileX(rv->route_hold_tile), TileY(rv->route_hold_tile), rv->route_hold_trackdir, rv->route_hold_station);
+				output.print(buffer);
+			}
 			seprintf(buffer, lastof(buffer), "  Roadtype: %u (0x" OTTD_PRINTFHEX64 "), Compatible: 0x" OTTD_PRINTFHEX64,
 					rv->roadtype, (static_cast<RoadTypes>(1) << rv->roadtype), rv->compatible_roadtypes);
 			output.print(buffer);
@@ -1324,6 +1329,8 @@ class NIHStationStruct : public NIHelper {
 			output.print(buffer);
 			seprintf(buffer, lastof(buffer), "  Docking tiles: %X, %u x %u", st->docking_station.tile, st->docking_station.w, st->docking_station.h);
 			output.print(buffer);
+			seprintf(buffer, lastof(buffer), "  Road vehicles queueing: %u", (uint) st->road_waiting_vehicles.size());
+			output.print(buffer);
 		}
 		const Waypoint *wp = Waypoint::GetIfValid(index);
 		if (wp) {
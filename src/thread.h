@@ -15,6 +15,8 @@
 #include <system_error>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <vector>
 #if defined(__MINGW32__)
 #include "3rdparty/mingw-std-threads/mingw.thread.h"
 #include "3rdparty/mingw-std-threads/mingw.mutex.h"
@@ -137,4 +139,44 @@ inline bool StartNewThread(std::thread *thr, const char *name, TFn&& _Fx, TArgs&
 	return false;
 }
 
+/**
+ * Run a job for each index in [0, count), spread over the available cores.
+ * The calling thread takes part, and only returns once all jobs are done.
+ * Each job must only modify state owned by that index, anything with effects on other objects
+ * or on the random generator must be applied afterwards, in index order, by the caller.
+ * @param count Number of jobs.
+ * @param min_jobs_per_thread Number of jobs below which starting another thread is not worth it.
+ * @param func Job function, called with the job index.
+ */
+template <typename F>
+void RunParallelJobs(size_t count, size_t min_jobs_per_thread, F func)
+{
+	size_t num_threads = std::min<size_t>(std::thread::hardware_concurrency(), count / std::max<size_t>(min_jobs_per_thread, 1));
+	if (num_threads <= 1) {
+		for (size_t i = 0; i < count; i++) func(i);
+		return;
+	}
+
+	const size_t chunk_size = std::max<size_t>(1, count / (num_threads * 8));
+	std::atomic<size_t> next_job(0);
+	auto worker = [&]() {
+		for (;;) {
+			size_t first = next_job.fetch_add(chunk_size, std::memory_order_relaxed);
+			if (first >= count) return;
+			size_t last = std::min(first + chunk_size, count);
+			for (size_t i = first; i < last; i++) func(i);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(num_threads - 1);
+	for (size_t i = 1; i < num_threads; i++) {
+		std::thread t;
+		if (!StartNewThread(&t, "ottd:jobs", [&]() { worker(); })) break;
+		threads.push_back(std::move(t));
+	}
+	worker();
+	for (std::thread &t : threads) t.join();
+}
+
 #endif /* THREAD_H */
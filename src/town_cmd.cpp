@@ -52,7 +52,7 @@
 #include "game/game.hpp"
 #include "zoom_func.h"
 #include "zoning.h"
-#include "scope.h"
+#include "thread.h"
 
 #include "table/strings.h"
 #include "table/town_land.h"
@@ -3748,6 +3748,11 @@ static void ForAllStationsNearTown(Town *t, Func func)
 	});
 }
 
+/**
+ * Monthly update of the company ratings of a town.
+ * This does not invalidate any windows or signs, so it may be run on a worker thread.
+ * @param t The town to update.
+ */
 static void UpdateTownRating(Town *t)
 {
 	if (_extra_cheats.town_rating.value) return;
@@ -3778,8 +3783,6 @@ static void UpdateTownRating(Town *t)
 		t->ratings[i] = Clamp(t->ratings[i], RATING_MINIMUM, RATING_MAXIMUM);
 	}
 
-	t->UpdateVirtCoord();
-	SetWindowDirty(WC_TOWN_AUTHORITY, t->index);
 }
 
 
@@ -3872,48 +3875,55 @@ static uint GetNormalGrowthRate(Town *t)
 }
 
 /**
- * Updates town growth rate.
+ * Recalculates town growth rate, without invalidating any windows.
  * @param t The town to update growth rate for
  */
-static void UpdateTownGrowthRate(Town *t)
+static void CalculateTownGrowthRate(Town *t)
 {
 	if (HasBit(t->flags, TOWN_CUSTOM_GROWTH)) return;
 	uint old_rate = t->growth_rate;
 	t->growth_rate = GetNormalGrowthRate(t);
 	UpdateTownGrowCounter(t, old_rate);
+}
+
+/**
+ * Updates town growth rate.
+ * @param t The town to update growth rate for
+ */
+static void UpdateTownGrowthRate(Town *t)
+{
+	CalculateTownGrowthRate(t);
 	SetWindowDirty(WC_TOWN_VIEW, t->index);
 }
 
 /**
- * Updates town growth state (whether it is growing or not).
+ * Updates town growth state (whether it is growing or not), except for the random part.
+ * This does not use the random generator or invalidate any windows, so it may be run on a worker thread.
  * @param t The town to update growth for
+ * @return true if the town is only to grow when a 1 in 12 chance succeeds, the caller must draw this.
  */
-static void UpdateTownGrowth(Town *t)
+static bool UpdateTownGrowthState(Town *t)
 {
-	auto guard = scope_guard([t]() {
-		SetWindowDirty(WC_TOWN_VIEW, t->index);
-	});
-
 	SetBit(t->flags, TOWN_IS_GROWING);
-	UpdateTownGrowthRate(t);
-	if (!HasBit(t->flags, TOWN_IS_GROWING)) return;
+	CalculateTownGrowthRate(t);
+	if (!HasBit(t->flags, TOWN_IS_GROWING)) return false;
 
 	ClrBit(t->flags, TOWN_IS_GROWING);
 
-	if (_settings_game.economy.town_growth_rate == 0 && t->fund_buildings_months == 0) return;
+	if (_settings_game.economy.town_growth_rate == 0 && t->fund_buildings_months == 0) return false;
 
 	if (t->fund_buildings_months == 0) {
 		/* Check if all goals are reached for this town to grow (given we are not funding it) */
 		for (int i = TE_BEGIN; i < TE_END; i++) {
 			switch (t->goal[i]) {
 				case TOWN_GROWTH_WINTER:
-					if (TileHeight(t->xy) >= GetSnowLine() && t->received[i].old_act == 0 && t->cache.population > 90) return;
+					if (TileHeight(t->xy) >= GetSnowLine() && t->received[i].old_act == 0 && t->cache.population > 90) return false;
 					break;
 				case TOWN_GROWTH_DESERT:
-					if (GetTropicZone(t->xy) == TROPICZONE_DESERT && t->received[i].old_act == 0 && t->cache.population > 60) return;
+					if (GetTropicZone(t->xy) == TROPICZONE_DESERT && t->received[i].old_act == 0 && t->cache.population > 60) return false;
 					break;
 				default:
-					if (t->goal[i] > t->received[i].old_act) return;
+					if (t->goal[i] > t->received[i].old_act) return false;
 					break;
 			}
 		}
@@ -3921,13 +3931,23 @@ static void UpdateTownGrowth(Town *t)
 
 	if (HasBit(t->flags, TOWN_CUSTOM_GROWTH)) {
 		if (t->growth_rate != TOWN_GROWTH_RATE_NONE) SetBit(t->flags, TOWN_IS_GROWING);
-		SetWindowDirty(WC_TOWN_VIEW, t->index);
-		return;
+		return false;
 	}
 
-	if (t->fund_buildings_months == 0 && CountActiveStations(t) == 0 && !Chance16(1, 12)) return;
+	if (t->fund_buildings_months == 0 && CountActiveStations(t) == 0) return true;
 
 	SetBit(t->flags, TOWN_IS_GROWING);
+	return false;
+}
+
+/**
+ * Updates town growth state (whether it is growing or not).
+ * @param t The town to update growth for
+ */
+static void UpdateTownGrowth(Town *t)
+{
+	if (UpdateTownGrowthState(t) && Chance16(1, 12)) SetBit(t->flags, TOWN_IS_GROWING);
+	SetWindowDirty(WC_TOWN_VIEW, t->index);
 }
 
 static void UpdateTownAmounts(Town *t)
@@ -3935,8 +3955,6 @@ static void UpdateTownAmounts(Town *t)
 	for (CargoID i = 0; i < NUM_CARGO; i++) t->supplied[i].NewMonth();
 	for (int i = TE_BEGIN; i < TE_END; i++) t->received[i].NewMonth();
 	if (t->fund_buildings_months != 0) t->fund_buildings_months--;
-
-	SetWindowDirty(WC_TOWN_VIEW, t->index);
 }
 
 static void UpdateTownUnwanted(Town *t)
@@ -4172,7 +4190,14 @@ CommandCost CheckforTownRating(DoCommandFlag flags, Town *t, TownRatingCheckType
 
 void TownsMonthlyLoop()
 {
-	for (Town *t : Town::Iterate()) {
+	std::vector<Town *> towns;
+	towns.reserve(Town::GetNumItems());
+	for (Town *t : Town::Iterate()) towns.push_back(t);
+
+	/* Per-town part: this only modifies the town itself, and reads stations and companies */
+	std::unique_ptr<bool[]> growth_chance(new bool[towns.size()]);
+	RunParallelJobs(towns.size(), 256, [&](size_t idx) {
+		Town *t = towns[idx];
 		if (t->road_build_months != 0) t->road_build_months--;
 
 		if (t->exclusive_counter != 0) {
@@ -4180,11 +4205,21 @@ void TownsMonthlyLoop()
 		}
 
 		UpdateTownAmounts(t);
-		UpdateTownGrowth(t);
+		growth_chance[idx] = UpdateTownGrowthState(t);
 		UpdateTownRating(t);
 		UpdateTownUnwanted(t);
-	}
+	});
 
+	/* Random draws, viewport signs and windows, in town order */
+	for (size_t idx = 0; idx < towns.size(); idx++) {
+		Town *t = towns[idx];
+		if (growth_chance[idx] && Chance16(1, 12)) SetBit(t->flags, TOWN_IS_GROWING);
+		SetWindowDirty(WC_TOWN_VIEW, t->index);
+		if (!_extra_cheats.town_rating.value) {
+			t->UpdateVirtCoord();
+			SetWindowDirty(WC_TOWN_AUTHORITY, t->index);
+		}
+	}
 }
 
 void TownsYearlyLoop()
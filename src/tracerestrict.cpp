@@ -236,22 +236,76 @@ static bool TestStationCondition(StationID station, TraceRestrictItem item)
 
 }
 
+/** Current execution cache epoch, 0 when program execution results are not being cached */
+static uint64 _tracerestrict_exec_cache_epoch = 0;
+
+/** Last allocated execution cache epoch */
+static uint64 _tracerestrict_exec_cache_last_epoch = 0;
+
+TraceRestrictExecutionCacheScope::TraceRestrictExecutionCacheScope()
+{
+	this->old_epoch = _tracerestrict_exec_cache_epoch;
+	_tracerestrict_exec_cache_epoch = ++_tracerestrict_exec_cache_last_epoch;
+}
+
+TraceRestrictExecutionCacheScope::~TraceRestrictExecutionCacheScope()
+{
+	/* A new epoch is used for the outer scope, as the state may have changed within this scope */
+	_tracerestrict_exec_cache_epoch = (this->old_epoch != 0) ? ++_tracerestrict_exec_cache_last_epoch : 0;
+}
+
 /**
  * Execute program on train and store results in out
+ * If a TraceRestrictExecutionCacheScope is active, and execution has no side effects and does not depend
+ * on the path taken to reach the signal, the result is cached
  * @p v may not be nullptr
  * @p out should be zero-initialised
  */
 void TraceRestrictProgram::Execute(const Train* v, const TraceRestrictProgramInput &input, TraceRestrictProgramResult& out) const
 {
-	// static to avoid needing to re-alloc/resize on each execution
-	static std::vector<TraceRestrictCondStackFlags> condstack;
-	condstack.clear();
+	if (_tracerestrict_exec_cache_epoch == 0 || input.permitted_slot_operations != 0 || (this->input_dependency_flags & TRPIDF_PREVIOUS_SIGNAL) ||
+			out.flags != 0 || out.penalty != 0) {
+		this->ExecuteUncached(v, input, out);
+		return;
+	}
+
+	const bool check_position = (this->input_dependency_flags & TRPIDF_ENTRY_DIRECTION);
+	if (this->exec_cache_epoch == _tracerestrict_exec_cache_epoch && this->exec_cache_vehicle == v->index &&
+			(!check_position || (this->exec_cache_tile == input.tile && this->exec_cache_trackdir == input.trackdir))) {
+		out = this->exec_cache_result;
+		return;
+	}
+
+	this->ExecuteUncached(v, input, out);
+	this->exec_cache_epoch = _tracerestrict_exec_cache_epoch;
+	this->exec_cache_vehicle = v->index;
+	this->exec_cache_tile = input.tile;
+	this->exec_cache_trackdir = input.trackdir;
+	this->exec_cache_result = out;
+}
+
+/**
+ * Execute program on train and store results in out, without using the execution cache
+ * @p v may not be nullptr
+ * @p out should be zero-initialised
+ */
+void TraceRestrictProgram::ExecuteUncached(const Train* v, const TraceRestrictProgramInput &input, TraceRestrictProgramResult& out) const
+{
+	assert(this->cond_jumps.size() == this->items.size());
 
 	byte have_previous_signal = 0;
 	TileIndex previous_signal_tile[2];
 
+	/*
+	 * Only active branches are executed, inactive branches are jumped over using the precomputed cond_jumps.
+	 * evaluate_branch is set when jumping to the next branch of a block, after the condition of the previous branch was false.
+	 * Otherwise, reaching an else/elif/orif item means that the end of an active branch has been reached.
+	 */
+	bool evaluate_branch = false;
+
 	size_t size = this->items.size();
-	for (size_t i = 0; i < size; i++) {
+	size_t i = 0;
+	while (i < size) {
 		TraceRestrictItem item = this->items[i];
 		TraceRestrictItemType type = GetTraceRestrictType(item);
 
@@ -259,18 +313,31 @@ void TraceRestrictProgram::Execute(const Train* v, const TraceRestrictProgramInp
 			TraceRestrictCondFlags condflags = GetTraceRestrictCondFlags(item);
 			TraceRestrictCondOp condop = GetTraceRestrictCondOp(item);
 
-			if (type == TRIT_COND_ENDIF) {
-				assert(!condstack.empty());
-				if (condflags & TRCF_ELSE) {
-					// else
-					assert(!(condstack.back() & TRCSF_SEEN_ELSE));
-					HandleCondition(condstack, condflags, true);
-					condstack.back() |= TRCSF_SEEN_ELSE;
+			if (type == TRIT_COND_ENDIF && !(condflags & TRCF_ELSE)) {
+				// end if
+				evaluate_branch = false;
+				i++;
+				continue;
+			}
+
+			if (!evaluate_branch && (condflags & (TRCF_ELSE | TRCF_OR))) {
+				if (condflags & TRCF_OR) {
+					// orif at end of active branch: the branch remains active, do not evaluate the condition
+					i += IsTraceRestrictDoubleItem(item) ? 2 : 1;
 				} else {
-					// end if
-					condstack.pop_back();
+					// else/elif at end of active branch: the block is done, skip to after the end if
+					i = this->cond_jumps[i].end_block + 1;
 				}
+				continue;
+			}
+			evaluate_branch = false;
+
+			if (type == TRIT_COND_ENDIF) {
+				// else, no previous branch was taken
+				i++;
+				continue;
 			} else {
+				const size_t cond_offset = i;
 				uint16 condvalue = GetTraceRestrictValue(item);
 				bool result = false;
 				switch(type) {
@@ -572,250 +639,338 @@ void TraceRestrictProgram::Execute(const Train* v, const TraceRestrictProgramInp
 					default:
 						NOT_REACHED();
 				}
-				HandleCondition(condstack, condflags, result);
+				if (result) {
+					i++;
+				} else {
+					i = this->cond_jumps[cond_offset].next_branch;
+					evaluate_branch = true;
+				}
 			}
 		} else {
-			if (condstack.empty() || condstack.back() & TRCSF_ACTIVE) {
-				switch(type) {
-					case TRIT_PF_DENY:
-						if (GetTraceRestrictValue(item)) {
-							out.flags &= ~TRPRF_DENY;
-						} else {
-							out.flags |= TRPRF_DENY;
-						}
-						break;
-
-					case TRIT_PF_PENALTY:
-						switch (static_cast<TraceRestrictPathfinderPenaltyAuxField>(GetTraceRestrictAuxField(item))) {
-							case TRPPAF_VALUE:
-								out.penalty += GetTraceRestrictValue(item);
-								break;
+			switch(type) {
+				case TRIT_PF_DENY:
+					if (GetTraceRestrictValue(item)) {
+						out.flags &= ~TRPRF_DENY;
+					} else {
+						out.flags |= TRPRF_DENY;
+					}
+					break;
 
-							case TRPPAF_PRESET: {
-								uint16 index = GetTraceRestrictValue(item);
-								assert(index < TRPPPI_END);
-								out.penalty += _tracerestrict_pathfinder_penalty_preset_values[index];
-								break;
-							}
+				case TRIT_PF_PENALTY:
+					switch (static_cast<TraceRestrictPathfinderPenaltyAuxField>(GetTraceRestrictAuxField(item))) {
+						case TRPPAF_VALUE:
+							out.penalty += GetTraceRestrictValue(item);
+							break;
 
-							default:
-								NOT_REACHED();
+						case TRPPAF_PRESET: {
+							uint16 index = GetTraceRestrictValue(item);
+							assert(index < TRPPPI_END);
+							out.penalty += _tracerestrict_pathfinder_penalty_preset_values[index];
+							break;
 						}
-						break;
 
-					case TRIT_RESERVE_THROUGH:
-						if (GetTraceRestrictValue(item)) {
-							out.flags &= ~TRPRF_RESERVE_THROUGH;
-						} else {
-							out.flags |= TRPRF_RESERVE_THROUGH;
-						}
-						break;
+						default:
+							NOT_REACHED();
+					}
+					break;
 
-					case TRIT_LONG_RESERVE:
-						if (GetTraceRestrictValue(item)) {
-							out.flags &= ~TRPRF_LONG_RESERVE;
-						} else {
-							out.flags |= TRPRF_LONG_RESERVE;
-						}
-						break;
+				case TRIT_RESERVE_THROUGH:
+					if (GetTraceRestrictValue(item)) {
+						out.flags &= ~TRPRF_RESERVE_THROUGH;
+					} else {
+						out.flags |= TRPRF_RESERVE_THROUGH;
+					}
+					break;
 
-					case TRIT_WAIT_AT_PBS:
-						switch (static_cast<TraceRestrictWaitAtPbsValueField>(GetTraceRestrictValue(item))) {
-							case TRWAPVF_WAIT_AT_PBS:
-								out.flags |= TRPRF_WAIT_AT_PBS;
-								break;
+				case TRIT_LONG_RESERVE:
+					if (GetTraceRestrictValue(item)) {
+						out.flags &= ~TRPRF_LONG_RESERVE;
+					} else {
+						out.flags |= TRPRF_LONG_RESERVE;
+					}
+					break;
 
-							case TRWAPVF_CANCEL_WAIT_AT_PBS:
-								out.flags &= ~TRPRF_WAIT_AT_PBS;
-								break;
+				case TRIT_WAIT_AT_PBS:
+					switch (static_cast<TraceRestrictWaitAtPbsValueField>(GetTraceRestrictValue(item))) {
+						case TRWAPVF_WAIT_AT_PBS:
+							out.flags |= TRPRF_WAIT_AT_PBS;
+							break;
 
-							case TRWAPVF_PBS_RES_END_WAIT:
-								out.flags |= TRPRF_PBS_RES_END_WAIT;
-								break;
+						case TRWAPVF_CANCEL_WAIT_AT_PBS:
+							out.flags &= ~TRPRF_WAIT_AT_PBS;
+							break;
 
-							case TRWAPVF_CANCEL_PBS_RES_END_WAIT:
-								out.flags &= ~TRPRF_PBS_RES_END_WAIT;
-								break;
+						case TRWAPVF_PBS_RES_END_WAIT:
+							out.flags |= TRPRF_PBS_RES_END_WAIT;
+							break;
 
-							default:
-								NOT_REACHED();
-								break;
-						}
-						break;
+						case TRWAPVF_CANCEL_PBS_RES_END_WAIT:
+							out.flags &= ~TRPRF_PBS_RES_END_WAIT;
+							break;
 
-					case TRIT_SLOT: {
-						if (!input.permitted_slot_operations) break;
-						TraceRestrictSlot *slot = TraceRestrictSlot::GetIfValid(GetTraceRestrictValue(item));
-						if (slot == nullptr || slot->vehicle_type != v->type) break;
-						switch (static_cast<TraceRestrictSlotCondOpField>(GetTraceRestrictCondOp(item))) {
-							case TRSCOF_ACQUIRE_WAIT:
-								if (input.permitted_slot_operations & TRPISP_ACQUIRE) {
-									if (!slot->Occupy(v->index)) out.flags |= TRPRF_WAIT_AT_PBS;
-								}
-								break;
+						default:
+							NOT_REACHED();
+							break;
+					}
+					break;
 
-							case TRSCOF_ACQUIRE_TRY:
-								if (input.permitted_slot_operations & TRPISP_ACQUIRE) slot->Occupy(v->index);
-								break;
+				case TRIT_SLOT: {
+					if (!input.permitted_slot_operations) break;
+					TraceRestrictSlot *slot = TraceRestrictSlot::GetIfValid(GetTraceRestrictValue(item));
+					if (slot == nullptr || slot->vehicle_type != v->type) break;
+					switch (static_cast<TraceRestrictSlotCondOpField>(GetTraceRestrictCondOp(item))) {
+						case TRSCOF_ACQUIRE_WAIT:
+							if (input.permitted_slot_operations & TRPISP_ACQUIRE) {
+								if (!slot->Occupy(v->index)) out.flags |= TRPRF_WAIT_AT_PBS;
+							}
+							break;
 
-							case TRSCOF_RELEASE_BACK:
-								if (input.permitted_slot_operations & TRPISP_RELEASE_BACK) slot->Vacate(v->index);
-								break;
+						case TRSCOF_ACQUIRE_TRY:
+							if (input.permitted_slot_operations & TRPISP_ACQUIRE) slot->Occupy(v->index);
+							break;
 
-							case TRSCOF_RELEASE_FRONT:
-								if (input.permitted_slot_operations & TRPISP_RELEASE_FRONT) slot->Vacate(v->index);
-								break;
+						case TRSCOF_RELEASE_BACK:
+							if (input.permitted_slot_operations & TRPISP_RELEASE_BACK) slot->Vacate(v->index);
+							break;
 
-							case TRSCOF_PBS_RES_END_ACQ_WAIT:
-								if (input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQUIRE) {
-									if (!slot->Occupy(v->index)) out.flags |= TRPRF_PBS_RES_END_WAIT;
-								} else if (input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQ_DRY) {
-									if (this->actions_used_flags & TRPAUF_PBS_RES_END_SIMULATE) {
-										if (!slot->OccupyDryRunUsingTemporaryState(v->index)) out.flags |= TRPRF_PBS_RES_END_WAIT;
-									} else {
-										if (!slot->OccupyDryRun(v->index)) out.flags |= TRPRF_PBS_RES_END_WAIT;
-									}
-								}
-								break;
+						case TRSCOF_RELEASE_FRONT:
+							if (input.permitted_slot_operations & TRPISP_RELEASE_FRONT) slot->Vacate(v->index);
+							break;
 
-							case TRSCOF_PBS_RES_END_ACQ_TRY:
-								if (input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQUIRE) {
-									slot->Occupy(v->index);
-								} else if ((input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQ_DRY) && (this->actions_used_flags & TRPAUF_PBS_RES_END_SIMULATE)) {
-									slot->OccupyDryRunUsingTemporaryState(v->index);
+						case TRSCOF_PBS_RES_END_ACQ_WAIT:
+							if (input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQUIRE) {
+								if (!slot->Occupy(v->index)) out.flags |= TRPRF_PBS_RES_END_WAIT;
+							} else if (input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQ_DRY) {
+								if (this->actions_used_flags & TRPAUF_PBS_RES_END_SIMULATE) {
+									if (!slot->OccupyDryRunUsingTemporaryState(v->index)) out.flags |= TRPRF_PBS_RES_END_WAIT;
+								} else {
+									if (!slot->OccupyDryRun(v->index)) out.flags |= TRPRF_PBS_RES_END_WAIT;
 								}
-								break;
+							}
+							break;
 
-							case TRSCOF_PBS_RES_END_RELEASE:
-								if (input.permitted_slot_operations & TRPISP_PBS_RES_END_RELEASE) {
-									slot->Vacate(v->index);
-								} else if ((input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQ_DRY) && (this->actions_used_flags & TRPAUF_PBS_RES_END_SIMULATE)) {
-									slot->VacateUsingTemporaryState(v->index);
-								}
-								break;
+						case TRSCOF_PBS_RES_END_ACQ_TRY:
+							if (input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQUIRE) {
+								slot->Occupy(v->index);
+							} else if ((input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQ_DRY) && (this->actions_used_flags & TRPAUF_PBS_RES_END_SIMULATE)) {
+								slot->OccupyDryRunUsingTemporaryState(v->index);
+							}
+							break;
 
-							case TRSCOF_ACQUIRE_TRY_ON_RESERVE:
-								if (input.permitted_slot_operations & TRPISP_ACQUIRE_ON_RES) slot->Occupy(v->index);
-								break;
+						case TRSCOF_PBS_RES_END_RELEASE:
+							if (input.permitted_slot_operations & TRPISP_PBS_RES_END_RELEASE) {
+								slot->Vacate(v->index);
+							} else if ((input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQ_DRY) && (this->actions_used_flags & TRPAUF_PBS_RES_END_SIMULATE)) {
+								slot->VacateUsingTemporaryState(v->index);
+							}
+							break;
 
-							default:
-								NOT_REACHED();
-								break;
-						}
-						break;
-					}
+						case TRSCOF_ACQUIRE_TRY_ON_RESERVE:
+							if (input.permitted_slot_operations & TRPISP_ACQUIRE_ON_RES) slot->Occupy(v->index);
+							break;
 
-					case TRIT_REVERSE:
-						switch (static_cast<TraceRestrictReverseValueField>(GetTraceRestrictValue(item))) {
-							case TRRVF_REVERSE:
-								out.flags |= TRPRF_REVERSE;
-								break;
+						default:
+							NOT_REACHED();
+							break;
+					}
+					break;
+				}
 
-							case TRRVF_CANCEL_REVERSE:
-								out.flags &= ~TRPRF_REVERSE;
-								break;
+				case TRIT_REVERSE:
+					switch (static_cast<TraceRestrictReverseValueField>(GetTraceRestrictValue(item))) {
+						case TRRVF_REVERSE:
+							out.flags |= TRPRF_REVERSE;
+							break;
 
-							default:
-								NOT_REACHED();
-								break;
-						}
-						break;
+						case TRRVF_CANCEL_REVERSE:
+							out.flags &= ~TRPRF_REVERSE;
+							break;
 
-					case TRIT_SPEED_RESTRICTION: {
-						out.speed_restriction = GetTraceRestrictValue(item);
-						out.flags |= TRPRF_SPEED_RESTRICTION_SET;
-						break;
+						default:
+							NOT_REACHED();
+							break;
 					}
+					break;
 
-					case TRIT_NEWS_CONTROL:
-						switch (static_cast<TraceRestrictNewsControlField>(GetTraceRestrictValue(item))) {
-							case TRNCF_TRAIN_NOT_STUCK:
-								out.flags |= TRPRF_TRAIN_NOT_STUCK;
-								break;
+				case TRIT_SPEED_RESTRICTION: {
+					out.speed_restriction = GetTraceRestrictValue(item);
+					out.flags |= TRPRF_SPEED_RESTRICTION_SET;
+					break;
+				}
 
-							case TRNCF_CANCEL_TRAIN_NOT_STUCK:
-								out.flags &= ~TRPRF_TRAIN_NOT_STUCK;
-								break;
+				case TRIT_NEWS_CONTROL:
+					switch (static_cast<TraceRestrictNewsControlField>(GetTraceRestrictValue(item))) {
+						case TRNCF_TRAIN_NOT_STUCK:
+							out.flags |= TRPRF_TRAIN_NOT_STUCK;
+							break;
 
-							default:
-								NOT_REACHED();
-								break;
-						}
-						break;
+						case TRNCF_CANCEL_TRAIN_NOT_STUCK:
+							out.flags &= ~TRPRF_TRAIN_NOT_STUCK;
+							break;
 
-					case TRIT_COUNTER: {
-						// TRVT_COUNTER_INDEX_INT value type uses the next slot
-						i++;
-						uint32_t value = this->items[i];
-						if (!(input.permitted_slot_operations & TRPISP_CHANGE_COUNTER)) break;
-						TraceRestrictCounter *ctr = TraceRestrictCounter::GetIfValid(GetTraceRestrictValue(item));
-						if (ctr == nullptr) break;
-						switch (static_cast<TraceRestrictCounterCondOpField>(GetTraceRestrictCondOp(item))) {
-							case TRCCOF_INCREASE:
-								ctr->UpdateValue(ctr->value + value);
-								break;
+						default:
+							NOT_REACHED();
+							break;
+					}
+					break;
 
-							case TRCCOF_DECREASE:
-								ctr->UpdateValue(ctr->value - value);
-								break;
+				case TRIT_COUNTER: {
+					// TRVT_COUNTER_INDEX_INT value type uses the next slot
+					i++;
+					uint32_t value = this->items[i];
+					if (!(input.permitted_slot_operations & TRPISP_CHANGE_COUNTER)) break;
+					TraceRestrictCounter *ctr = TraceRestrictCounter::GetIfValid(GetTraceRestrictValue(item));
+					if (ctr == nullptr) break;
+					switch (static_cast<TraceRestrictCounterCondOpField>(GetTraceRestrictCondOp(item))) {
+						case TRCCOF_INCREASE:
+							ctr->UpdateValue(ctr->value + value);
+							break;
 
-							case TRCCOF_SET:
-								ctr->UpdateValue(value);
-								break;
+						case TRCCOF_DECREASE:
+							ctr->UpdateValue(ctr->value - value);
+							break;
 
-							default:
-								NOT_REACHED();
-								break;
-						}
-						break;
+						case TRCCOF_SET:
+							ctr->UpdateValue(value);
+							break;
+
+						default:
+							NOT_REACHED();
+							break;
 					}
+					break;
+				}
 
-					case TRIT_PF_PENALTY_CONTROL:
-						switch (static_cast<TraceRestrictPfPenaltyControlField>(GetTraceRestrictValue(item))) {
-							case TRPPCF_NO_PBS_BACK_PENALTY:
-								out.flags |= TRPRF_NO_PBS_BACK_PENALTY;
-								break;
+				case TRIT_PF_PENALTY_CONTROL:
+					switch (static_cast<TraceRestrictPfPenaltyControlField>(GetTraceRestrictValue(item))) {
+						case TRPPCF_NO_PBS_BACK_PENALTY:
+							out.flags |= TRPRF_NO_PBS_BACK_PENALTY;
+							break;
 
-							case TRPPCF_CANCEL_NO_PBS_BACK_PENALTY:
-								out.flags &= ~TRPRF_NO_PBS_BACK_PENALTY;
-								break;
+						case TRPPCF_CANCEL_NO_PBS_BACK_PENALTY:
+							out.flags &= ~TRPRF_NO_PBS_BACK_PENALTY;
+							break;
 
-							default:
-								NOT_REACHED();
-								break;
-						}
-						break;
+						default:
+							NOT_REACHED();
+							break;
+					}
+					break;
 
-					case TRIT_SPEED_ADAPTATION_CONTROL:
-						switch (static_cast<TraceRestrictSpeedAdaptationControlField>(GetTraceRestrictValue(item))) {
-							case TRSACF_SPEED_ADAPT_EXEMPT:
-								out.flags |= TRPRF_SPEED_ADAPT_EXEMPT;
-								out.flags &= ~TRPRF_RM_SPEED_ADAPT_EXEMPT;
-								break;
+				case TRIT_SPEED_ADAPTATION_CONTROL:
+					switch (static_cast<TraceRestrictSpeedAdaptationControlField>(GetTraceRestrictValue(item))) {
+						case TRSACF_SPEED_ADAPT_EXEMPT:
+							out.flags |= TRPRF_SPEED_ADAPT_EXEMPT;
+							out.flags &= ~TRPRF_RM_SPEED_ADAPT_EXEMPT;
+							break;
 
-							case TRSACF_REMOVE_SPEED_ADAPT_EXEMPT:
-								out.flags &= ~TRPRF_SPEED_ADAPT_EXEMPT;
-								out.flags |= TRPRF_RM_SPEED_ADAPT_EXEMPT;
-								break;
+						case TRSACF_REMOVE_SPEED_ADAPT_EXEMPT:
+							out.flags &= ~TRPRF_SPEED_ADAPT_EXEMPT;
+							out.flags |= TRPRF_RM_SPEED_ADAPT_EXEMPT;
+							break;
 
-							default:
-								NOT_REACHED();
-								break;
-						}
-						break;
+						default:
+							NOT_REACHED();
+							break;
+					}
+					break;
 
-					default:
-						NOT_REACHED();
-				}
-			} else {
-				if (IsTraceRestrictDoubleItem(type)) i++;
+				default:
+					NOT_REACHED();
 			}
+			i++;
 		}
 	}
 	if ((input.permitted_slot_operations & TRPISP_PBS_RES_END_ACQ_DRY) && (this->actions_used_flags & TRPAUF_PBS_RES_END_SIMULATE)) {
 		TraceRestrictSlot::RevertTemporaryChanges(v->index);
 	}
-	assert(condstack.empty());
+}
+
+/**
+ * Get the set of inputs which the conditionals in an instruction list depend on, which affect whether the result can be cached
+ * @param items instruction list, this should have been validated
+ * @return input dependency flags
+ */
+TraceRestrictProgramInputDependencyFlags TraceRestrictProgram::GetInputDependencies(const std::vector<TraceRestrictItem> &items)
+{
+	TraceRestrictProgramInputDependencyFlags flags = static_cast<TraceRestrictProgramInputDependencyFlags>(0);
+
+	size_t size = items.size();
+	for (size_t i = 0; i < size; i++) {
+		TraceRestrictItem item = items[i];
+		if (IsTraceRestrictDoubleItem(item)) i++;
+		if (!IsTraceRestrictConditional(item)) continue;
+
+		switch (GetTraceRestrictType(item)) {
+			case TRIT_COND_ENTRY_DIRECTION:
+				flags |= TRPIDF_ENTRY_DIRECTION;
+				break;
+
+			case TRIT_COND_PBS_ENTRY_SIGNAL:
+				flags |= TRPIDF_PREVIOUS_SIGNAL;
+				break;
+
+			default:
+				break;
+		}
+	}
+	return flags;
+}
+
+/**
+ * Precompute the jump targets of the conditional instructions, such that execution
+ * can jump over branches which are not taken, without needing to track a condition stack.
+ * Blocks which are not correctly terminated jump to the end of the program.
+ */
+void TraceRestrictProgram::Compile()
+{
+	const uint32 size = (uint32)this->items.size();
+	this->cond_jumps.assign(size, { size, size });
+
+	/* Array offsets of the if/elif/orif/else instructions of the currently open blocks */
+	static std::vector<uint32> branches;
+	branches.clear();
+	/* Index into branches of the first branch of each open block */
+	static std::vector<size_t> blocks;
+	blocks.clear();
+
+	for (uint32 i = 0; i < size; i++) {
+		const uint32 offset = i;
+		TraceRestrictItem item = this->items[i];
+		if (IsTraceRestrictDoubleItem(item)) i++;
+		if (!IsTraceRestrictConditional(item)) continue;
+
+		TraceRestrictCondFlags condflags = GetTraceRestrictCondFlags(item);
+		if (GetTraceRestrictType(item) == TRIT_COND_ENDIF && !(condflags & TRCF_ELSE)) {
+			// end if
+			if (blocks.empty()) continue;
+			this->cond_jumps[branches.back()].next_branch = offset;
+			for (size_t j = blocks.back(); j < branches.size(); j++) {
+				this->cond_jumps[branches[j]].end_block = offset;
+			}
+			branches.resize(blocks.back());
+			blocks.pop_back();
+		} else if (condflags & (TRCF_ELSE | TRCF_OR)) {
+			// else, elif or orif
+			if (blocks.empty()) continue;
+			this->cond_jumps[branches.back()].next_branch = offset;
+			branches.push_back(offset);
+		} else {
+			// if
+			blocks.push_back(branches.size());
+			branches.push_back(offset);
+		}
+	}
+}
+
+/**
+ * Update state derived from the instruction list, this must be called whenever the instruction list is changed
+ */
+void TraceRestrictProgram::ItemsChanged()
+{
+	this->input_dependency_flags = TraceRestrictProgram::GetInputDependencies(this->items);
+	this->exec_cache_epoch = 0;
+	this->Compile();
 }
 
 /**
@@ -1643,6 +1798,7 @@ CommandCost CmdProgramSignalTraceRestrict(TileIndex tile, DoCommandFlag flags, u
 		// move in modified program
 		prog->items.swap(items);
 		prog->actions_used_flags = actions_used_flags;
+		prog->ItemsChanged();
 
 		if (prog->items.size() == 0 && prog->refcount == 1) {
 			// program is empty, and this tile is the only reference to it
@@ -425,6 +425,16 @@ enum TraceRestrictProgramActionsUsedFlags {
 };
 DECLARE_ENUM_AS_BIT_SET(TraceRestrictProgramActionsUsedFlags)
 
+/**
+ * Enumeration for TraceRestrictProgram::input_dependency_flags
+ * This is the set of inputs read by the conditionals of a program which affect whether its result can be cached
+ */
+enum TraceRestrictProgramInputDependencyFlags {
+	TRPIDF_ENTRY_DIRECTION        = 1 << 0,  ///< Signal tile and direction of entry
+	TRPIDF_PREVIOUS_SIGNAL        = 1 << 1,  ///< Previous signal, this depends on the path taken to reach the signal
+};
+DECLARE_ENUM_AS_BIT_SET(TraceRestrictProgramInputDependencyFlags)
+
 /**
  * Enumeration for TraceRestrictProgramInput::permitted_slot_operations
  */
@@ -469,6 +479,15 @@ struct TraceRestrictProgramResult {
 			: penalty(0), flags(static_cast<TraceRestrictProgramResultFlags>(0)) { }
 };
 
+/**
+ * Precomputed jump targets of a conditional instruction in a TraceRestrictProgram
+ * These are only set for if/elif/orif/else instructions, the targets are array offsets
+ */
+struct TraceRestrictCondJumpTargets {
+	uint32 next_branch;                      ///< The next elif/orif/else/end if of the same block, to jump to if this branch is not taken
+	uint32 end_block;                        ///< The end if of the same block, to jump to at the end of a taken branch
+};
+
 /**
  * Program type, this stores the instruction list
  * This is refcounted, see info at top of tracerestrict.cpp
@@ -477,9 +496,24 @@ struct TraceRestrictProgram : TraceRestrictProgramPool::PoolItem<&_tracerestrict
 	std::vector<TraceRestrictItem> items;
 	uint32 refcount;
 	TraceRestrictProgramActionsUsedFlags actions_used_flags;
+	TraceRestrictProgramInputDependencyFlags input_dependency_flags;
+
+private:
+	std::vector<TraceRestrictCondJumpTargets> cond_jumps; ///< Jump targets of conditional instructions, indexed by array offset, see Compile
+	mutable uint64 exec_cache_epoch;                 ///< Execution cache epoch of the cached result, 0 if there is no cached result
+	mutable VehicleID exec_cache_vehicle;            ///< Vehicle of the cached result
+	mutable TileIndex exec_cache_tile;               ///< Signal tile of the cached result, only used with TRPIDF_ENTRY_DIRECTION
+	mutable Trackdir exec_cache_trackdir;            ///< Signal trackdir of the cached result, only used with TRPIDF_ENTRY_DIRECTION
+	mutable TraceRestrictProgramResult exec_cache_result; ///< Cached result
 
+	void ExecuteUncached(const Train *v, const TraceRestrictProgramInput &input, TraceRestrictProgramResult &out) const;
+
+	void Compile();
+
+public:
 	TraceRestrictProgram()
-			: refcount(0), actions_used_flags(static_cast<TraceRestrictProgramActionsUsedFlags>(0)) { }
+			: refcount(0), actions_used_flags(static_cast<TraceRestrictProgramActionsUsedFlags>(0)),
+			input_dependency_flags(static_cast<TraceRestrictProgramInputDependencyFlags>(0)), exec_cache_epoch(0) { }
 
 	void Execute(const Train *v, const TraceRestrictProgramInput &input, TraceRestrictProgramResult &out) const;
 
@@ -532,13 +566,33 @@ struct TraceRestrictProgram : TraceRestrictProgramPool::PoolItem<&_tracerestrict
 		return items.begin() + TraceRestrictProgram::InstructionOffsetToArrayOffset(items, instruction_offset);
 	}
 
+	static TraceRestrictProgramInputDependencyFlags GetInputDependencies(const std::vector<TraceRestrictItem> &items);
+
+	void ItemsChanged();
+
 	/** Call validation function on current program instruction list and set actions_used_flags */
 	CommandCost Validate()
 	{
-		return TraceRestrictProgram::Validate(items, actions_used_flags);
+		CommandCost result = TraceRestrictProgram::Validate(items, actions_used_flags);
+		this->ItemsChanged();
+		return result;
 	}
 };
 
+/**
+ * While an instance of this exists, results of side-effect free trace restrict program executions are cached.
+ * This must only be used where the state of the vehicles, slots, counters and date does not change,
+ * such as the node search of a single pathfinder run.
+ */
+struct TraceRestrictExecutionCacheScope {
+private:
+	uint64 old_epoch;
+
+public:
+	TraceRestrictExecutionCacheScope();
+	~TraceRestrictExecutionCacheScope();
+};
+
 /** Get TraceRestrictItem type field */
 static inline TraceRestrictItemType GetTraceRestrictType(TraceRestrictItem item)
 {
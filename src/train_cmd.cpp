@@ -966,6 +966,81 @@ static void ApplyLookAheadItem(const Train *v, const TrainReservationLookAheadIt
 	}
 }
 
+/**
+ * Get the last position up to which applying a lookahead speed limit is known to either have no effect,
+ * or to have the constant effect of capping the speed at the limit.
+ * @param stats Deceleration stats of the train.
+ * @param current_position Current lookahead position of the train.
+ * @param position Position of the speed limit, or a lower bound of it if not exact.
+ * @param end_speed Speed of the speed limit, or a lower bound of it if not exact.
+ * @param z_delta Height difference between the speed limit and the train.
+ * @param max_speed Upper bound of the speed which the limit is applied to.
+ * @param exact Whether position and end_speed are exact.
+ * @return Last position for which the effect of the limit is known, this is less than current_position if it is not known now.
+ */
+static int32 GetLookAheadLimitStablePosition(const TrainDecelerationStats &stats, int current_position, int position, int end_speed, int z_delta, int max_speed, bool exact)
+{
+	if (position <= current_position) return exact ? INT32_MAX : INT32_MIN;
+	if (end_speed >= max_speed) return position - 1;
+	int64 distance = GetRealisticBrakingDistanceForSpeed(stats, max_speed, end_speed, z_delta);
+	return (int32)std::max<int64>(INT32_MIN, position - distance);
+}
+
+/**
+ * Get the last position for which the result of applying the lookahead to the train's speed limits is unchanged,
+ * provided that the lookahead and the inputs to the speed calculation are otherwise unchanged.
+ * Limits which depend on the order list are bounded conservatively, as the order state may change without changing the lookahead.
+ * @param v Train.
+ * @param stats Deceleration stats of the train.
+ * @param max_speed Max speed before applying the lookahead.
+ * @param advisory_max_speed Advisory max speed before applying the lookahead.
+ * @return Last position for which the result is unchanged, this is less than the current position if the result must not be cached.
+ */
+static int32 GetLookAheadSpeedStablePosition(const Train *v, const TrainDecelerationStats &stats, int max_speed, int advisory_max_speed)
+{
+	const TrainReservationLookAhead &lookahead = *v->lookahead;
+	const int current_position = lookahead.current_position;
+	int32 result = INT32_MAX;
+	auto check = [&](int position, int end_speed, int z, int speed, bool exact) {
+		result = std::min(result, GetLookAheadLimitStablePosition(stats, current_position, position, end_speed, z - stats.z_pos, speed, exact));
+	};
+
+	if (HasBit(lookahead.flags, TRLF_DEPOT_END)) {
+		check(lookahead.reservation_end_position - TILE_SIZE, 61, lookahead.reservation_end_z, max_speed, true);
+	} else {
+		check(lookahead.reservation_end_position, 0, lookahead.reservation_end_z, max_speed, true);
+	}
+	for (const TrainReservationLookAheadItem &item : lookahead.items) {
+		if (result < current_position) break;
+		switch (item.type) {
+			case TRLIT_STATION:
+				/* The stopping location is at least the station length before the end of the station */
+				check(item.start - (item.end - item.start), 0, item.z_pos, advisory_max_speed, false);
+				break;
+
+			case TRLIT_REVERSE:
+				check(item.start, 0, item.z_pos, advisory_max_speed, false);
+				break;
+
+			case TRLIT_TRACK_SPEED:
+				check(item.start, item.data_id, item.z_pos, max_speed, true);
+				break;
+
+			case TRLIT_SPEED_RESTRICTION:
+				if (item.data_id > 0) check(item.start, item.data_id, item.z_pos, advisory_max_speed, true);
+				break;
+
+			case TRLIT_SIGNAL:
+				break;
+
+			case TRLIT_CURVE_SPEED:
+				if (_settings_game.vehicle.train_acceleration_model != AM_ORIGINAL) check(item.start, item.data_id, item.z_pos, max_speed, true);
+				break;
+		}
+	}
+	return result;
+}
+
 static void AdvanceLookAheadPosition(Train *v)
 {
 	v->lookahead->current_position++;
@@ -990,6 +1065,7 @@ static void AdvanceLookAheadPosition(Train *v)
 		for (TrainReservationLookAheadCurve &curve : v->lookahead->curves) {
 			curve.position -= old_position;
 		}
+		v->lookahead->items_version++;
 	}
 
 	while (!v->lookahead->items.empty() && v->lookahead->items.front().end < v->lookahead->current_position) {
@@ -1005,6 +1081,7 @@ static void AdvanceLookAheadPosition(Train *v)
 			if (v->lookahead->items.front().end >= trim_position) break;
 		}
 		v->lookahead->items.pop_front();
+		v->lookahead->items_version++;
 	}
 
 	if (v->lookahead->current_position == v->lookahead->next_extend_position) {
@@ -1100,19 +1177,49 @@ Train::MaxSpeedInfo Train::GetCurrentMaxSpeedInfoInternal(bool update_state) con
 				this->lookahead->zpos_refresh_remaining = this->GetZPosCacheUpdateInterval();
 			}
 			TrainDecelerationStats stats(this, this->lookahead->cached_zpos);
-			if (HasBit(this->lookahead->flags, TRLF_DEPOT_END)) {
-				LimitSpeedFromLookAhead(max_speed, stats, this->lookahead->current_position, this->lookahead->reservation_end_position - TILE_SIZE, 61, this->lookahead->reservation_end_z - stats.z_pos);
+			TrainReservationLookAhead::SpeedCache &cache = this->lookahead->speed_cache;
+			const int32 current_position = this->lookahead->current_position;
+			if (cache.items_version == this->lookahead->items_version && current_position >= cache.valid_from && current_position <= cache.valid_until &&
+					cache.reservation_end_position == this->lookahead->reservation_end_position && cache.reservation_end_z == this->lookahead->reservation_end_z &&
+					cache.flags == this->lookahead->flags && cache.z_pos == stats.z_pos && cache.deceleration_x2 == stats.deceleration_x2 &&
+					cache.uncapped_deceleration_x2 == stats.uncapped_deceleration_x2 && cache.in_max_speed == max_speed && cache.in_advisory_max_speed == advisory_max_speed &&
+					cache.slope_steepness == _settings_game.vehicle.train_slope_steepness && cache.acceleration_model == _settings_game.vehicle.train_acceleration_model) {
+				max_speed = cache.out_max_speed;
+				advisory_max_speed = cache.out_advisory_max_speed;
 			} else {
-				LimitSpeedFromLookAhead(max_speed, stats, this->lookahead->current_position, this->lookahead->reservation_end_position, 0, this->lookahead->reservation_end_z - stats.z_pos);
-			}
-			VehicleOrderID current_order_index = this->cur_real_order_index;
-			const Order *order = &(this->current_order);
-			StationID last_station_visited = this->last_station_visited;
-			for (const TrainReservationLookAheadItem &item : this->lookahead->items) {
-				ApplyLookAheadItem(this, item, max_speed, advisory_max_speed, current_order_index, order, last_station_visited, stats, this->lookahead->current_position);
-			}
-			if (HasBit(this->lookahead->flags, TRLF_APPLY_ADVISORY)) {
-				max_speed = std::min(max_speed, advisory_max_speed);
+				const int in_max_speed = max_speed;
+				const int in_advisory_max_speed = advisory_max_speed;
+				if (HasBit(this->lookahead->flags, TRLF_DEPOT_END)) {
+					LimitSpeedFromLookAhead(max_speed, stats, this->lookahead->current_position, this->lookahead->reservation_end_position - TILE_SIZE, 61, this->lookahead->reservation_end_z - stats.z_pos);
+				} else {
+					LimitSpeedFromLookAhead(max_speed, stats, this->lookahead->current_position, this->lookahead->reservation_end_position, 0, this->lookahead->reservation_end_z - stats.z_pos);
+				}
+				VehicleOrderID current_order_index = this->cur_real_order_index;
+				const Order *order = &(this->current_order);
+				StationID last_station_visited = this->last_station_visited;
+				for (const TrainReservationLookAheadItem &item : this->lookahead->items) {
+					ApplyLookAheadItem(this, item, max_speed, advisory_max_speed, current_order_index, order, last_station_visited, stats, this->lookahead->current_position);
+				}
+				if (HasBit(this->lookahead->flags, TRLF_APPLY_ADVISORY)) {
+					max_speed = std::min(max_speed, advisory_max_speed);
+				}
+
+				/* Cache the result for as long as no limit is in the braking regime */
+				cache.valid_until = GetLookAheadSpeedStablePosition(this, stats, in_max_speed, in_advisory_max_speed);
+				cache.valid_from = current_position;
+				cache.items_version = this->lookahead->items_version;
+				cache.reservation_end_position = this->lookahead->reservation_end_position;
+				cache.reservation_end_z = this->lookahead->reservation_end_z;
+				cache.flags = this->lookahead->flags;
+				cache.z_pos = stats.z_pos;
+				cache.deceleration_x2 = stats.deceleration_x2;
+				cache.uncapped_deceleration_x2 = stats.uncapped_deceleration_x2;
+				cache.in_max_speed = in_max_speed;
+				cache.in_advisory_max_speed = in_advisory_max_speed;
+				cache.slope_steepness = _settings_game.vehicle.train_slope_steepness;
+				cache.acceleration_model = _settings_game.vehicle.train_acceleration_model;
+				cache.out_max_speed = max_speed;
+				cache.out_advisory_max_speed = advisory_max_speed;
 			}
 		} else {
 			advisory_max_speed = std::min(advisory_max_speed, 30);
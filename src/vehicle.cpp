@@ -476,6 +476,51 @@ const int HASH_RES = 0;
 
 static Vehicle *_vehicle_tile_hash[TOTAL_HASH_SIZE * 4];
 
+/**
+ * Exact per-tile index of road vehicles.
+ * Road vehicles queue and overtake on the same few tiles, so the aliased tile hash chains above get long in busy towns.
+ * This maps each occupied tile to the head of a chain of only the road vehicles on that tile.
+ */
+static std::unordered_map<TileIndex, RoadVehicle *> _road_vehicle_tile_index;
+
+static void UpdateRoadVehicleTileIndex(RoadVehicle *v, TileIndex tile)
+{
+	if (v->tile_occupancy_tile == tile) return;
+
+	if (v->tile_occupancy_tile != INVALID_TILE) {
+		if (v->tile_occupancy_next != nullptr) v->tile_occupancy_next->tile_occupancy_prev = v->tile_occupancy_prev;
+		*v->tile_occupancy_prev = v->tile_occupancy_next;
+		if (v->tile_occupancy_next == nullptr) {
+			/* Drop the entry for tiles which no longer have any road vehicles */
+			auto iter = _road_vehicle_tile_index.find(v->tile_occupancy_tile);
+			if (iter->second == nullptr) _road_vehicle_tile_index.erase(iter);
+		}
+	}
+
+	if (tile != INVALID_TILE) {
+		RoadVehicle *&head = _road_vehicle_tile_index[tile];
+		v->tile_occupancy_next = head;
+		if (v->tile_occupancy_next != nullptr) v->tile_occupancy_next->tile_occupancy_prev = &v->tile_occupancy_next;
+		v->tile_occupancy_prev = &head;
+		head = v;
+	}
+
+	v->tile_occupancy_tile = tile;
+}
+
+static Vehicle *RoadVehicleFromTileIndex(TileIndex tile, void *data, VehicleFromPosProc *proc, bool find_first)
+{
+	auto iter = _road_vehicle_tile_index.find(tile);
+	if (iter == _road_vehicle_tile_index.end()) return nullptr;
+
+	for (RoadVehicle *v = iter->second; v != nullptr; v = v->tile_occupancy_next) {
+		Vehicle *a = proc(v, data);
+		if (find_first && a != nullptr) return a;
+	}
+
+	return nullptr;
+}
+
 static Vehicle *VehicleFromTileHash(int xl, int yl, int xu, int yu, VehicleType type, void *data, VehicleFromPosProc *proc, bool find_first)
 {
 	for (int y = yl; ; y = (y + (1 << HASH_BITS)) & (HASH_MASK << HASH_BITS)) {
@@ -515,6 +560,21 @@ Vehicle *VehicleFromPosXY(int x, int y, VehicleType type, void *data, VehicleFro
 	int yl = GB((y - COLL_DIST) / TILE_SIZE, HASH_RES, HASH_BITS) << HASH_BITS;
 	int yu = GB((y + COLL_DIST) / TILE_SIZE, HASH_RES, HASH_BITS) << HASH_BITS;
 
+	if (type == VEH_ROAD) {
+		/* Scan the exact tiles covered by the area, instead of every vehicle in the aliased hash buckets */
+		uint tx_min = std::max(x - COLL_DIST, 0) / TILE_SIZE;
+		uint tx_max = std::min<uint>(std::max(x + COLL_DIST, 0) / TILE_SIZE, MapMaxX());
+		uint ty_min = std::max(y - COLL_DIST, 0) / TILE_SIZE;
+		uint ty_max = std::min<uint>(std::max(y + COLL_DIST, 0) / TILE_SIZE, MapMaxY());
+		for (uint ty = ty_min; ty <= ty_max; ty++) {
+			for (uint tx = tx_min; tx <= tx_max; tx++) {
+				Vehicle *a = RoadVehicleFromTileIndex(TileXY(tx, ty), data, proc, find_first);
+				if (find_first && a != nullptr) return a;
+			}
+		}
+		return nullptr;
+	}
+
 	return VehicleFromTileHash(xl, yl, xu, yu, type, data, proc, find_first);
 }
 
@@ -530,6 +590,8 @@ Vehicle *VehicleFromPosXY(int x, int y, VehicleType type, void *data, VehicleFro
  */
 Vehicle *VehicleFromPos(TileIndex tile, VehicleType type, void *data, VehicleFromPosProc *proc, bool find_first)
 {
+	if (type == VEH_ROAD) return RoadVehicleFromTileIndex(tile, data, proc, find_first);
+
 	int x = GB(TileX(tile), HASH_RES, HASH_BITS);
 	int y = GB(TileY(tile), HASH_RES, HASH_BITS) << HASH_BITS;
 
@@ -829,6 +891,9 @@ void UpdateVehicleTileHash(Vehicle *v, bool remove)
 	Vehicle **old_hash = v->hash_tile_current;
 	Vehicle **new_hash;
 
+	/* Road vehicles are removed from the tile index in PreDestructor, while the RoadVehicle part is still valid */
+	if (v->type == VEH_ROAD && !remove) UpdateRoadVehicleTileIndex(RoadVehicle::From(v), HasBit(v->subtype, GVSF_VIRTUAL) ? INVALID_TILE : v->tile);
+
 	if (remove || HasBit(v->subtype, GVSF_VIRTUAL)) {
 		new_hash = nullptr;
 	} else {
@@ -861,6 +926,8 @@ bool ValidateVehicleTileHash(const Vehicle *v)
 {
 	if ((v->type == VEH_TRAIN && Train::From(v)->IsVirtual()) || v->type >= VEH_COMPANY_END) return v->hash_tile_current == nullptr;
 
+	if (v->type == VEH_ROAD && RoadVehicle::From(v)->tile_occupancy_tile != v->tile) return false;
+
 	int x = GB(TileX(v->tile), HASH_RES, HASH_BITS);
 	int y = GB(TileY(v->tile), HASH_RES, HASH_BITS) << HASH_BITS;
 	return v->hash_tile_current == &_vehicle_tile_hash[((x + y) & TOTAL_HASH_MASK) + (TOTAL_HASH_SIZE * v->type)];
@@ -940,8 +1007,10 @@ static void ProcessDeferredUpdateVehicleViewportHashes()
 void ResetVehicleHash()
 {
 	for (Vehicle *v : Vehicle::Iterate()) { v->hash_tile_current = nullptr; }
+	for (RoadVehicle *v : RoadVehicle::Iterate()) { v->tile_occupancy_tile = INVALID_TILE; }
 	memset(_vehicle_viewport_hash, 0, sizeof(_vehicle_viewport_hash));
 	memset(_vehicle_tile_hash, 0, sizeof(_vehicle_tile_hash));
+	_road_vehicle_tile_index.clear();
 }
 
 void ResetVehicleColourMap()
@@ -1096,6 +1165,11 @@ void Vehicle::PreDestructor()
 
 	SCOPE_INFO_FMT([this], "Vehicle::PreDestructor: %s", scope_dumper().VehicleInfo(this));
 
+	if (this->type == VEH_ROAD) {
+		UpdateRoadVehicleTileIndex(RoadVehicle::From(this), INVALID_TILE);
+		RoadVehicle::From(this)->ClearRouteHold();
+	}
+
 	if (Station::IsValidID(this->last_station_visited)) {
 		Station *st = Station::Get(this->last_station_visited);
 		st->loading_vehicles.erase(std::remove(st->loading_vehicles.begin(), st->loading_vehicles.end(), this), st->loading_vehicles.end());
@@ -1217,6 +1291,7 @@ Vehicle::~Vehicle()
 void Vehicle::PreCleanPool()
 {
 	pending_speed_restriction_change_map.clear();
+	_road_vehicle_tile_index.clear();
 }
 
 /**
@@ -232,10 +232,49 @@ void BaseVehicleListWindow::BuildVehicleList()
 
 	DEBUG(misc, 3, "Building vehicle list type %d for company %d given index %d", this->vli.type, this->vli.company, this->vli.index);
 
+	/* The order of the last sort is kept for the vehicles which are still listed, and only the vehicles which were
+	 * added have to be sorted in. This is only done for sort criteria whose keys do not change while a vehicle
+	 * exists, and those keys are part of what identifies a vehicle again after the rebuild. */
+	const uint8 sort_type = this->vehgroups.SortType();
+	const bool keep_order = this->grouping == GB_NONE && (sort_type == VST_NUMBER || sort_type == VST_MODEL) &&
+			sort_type == this->sorted_vehicles_type && this->vehgroups.IsDescSortOrder() == this->sorted_vehicles_desc;
+	std::vector<SortedVehicle> prev_order;
+	if (keep_order) prev_order = std::move(this->sorted_vehicles);
+	this->sorted_vehicles.clear();
+
 	this->vehgroups.clear();
 
 	GenerateVehicleSortList(&this->vehicles, this->vli);
 
+	size_t presorted = 0;
+	if (!prev_order.empty()) {
+		/* Previously listed vehicles may no longer exist, and their pool slots may have been reused by other vehicles. */
+		std::vector<VehicleID> listed;
+		listed.reserve(this->vehicles.size());
+		for (const Vehicle *v : this->vehicles) listed.push_back(v->index);
+		std::sort(listed.begin(), listed.end());
+
+		VehicleList reordered;
+		reordered.reserve(this->vehicles.size());
+		std::vector<VehicleID> kept;
+		for (const SortedVehicle &prev : prev_order) {
+			if (!std::binary_search(listed.begin(), listed.end(), prev.index)) continue;
+			const Vehicle *v = Vehicle::Get(prev.index);
+			if (v->unitnumber != prev.unitnumber || v->engine_type != prev.engine_type || v->build_year != prev.build_year) continue;
+			reordered.push_back(v);
+			kept.push_back(prev.index);
+		}
+		presorted = reordered.size();
+
+		if (presorted > 0) {
+			std::sort(kept.begin(), kept.end());
+			for (const Vehicle *v : this->vehicles) {
+				if (!std::binary_search(kept.begin(), kept.end(), v->index)) reordered.push_back(v);
+			}
+			this->vehicles = std::move(reordered);
+		}
+	}
+
 	if (this->grouping == GB_NONE) {
 		uint max_unitnumber = 0;
 		for (auto it = this->vehicles.begin(); it != this->vehicles.end(); ++it) {
@@ -270,7 +309,17 @@ void BaseVehicleListWindow::BuildVehicleList()
 	this->FilterVehicleList();
 	this->CountOwnVehicles();
 
-	this->vehgroups.RebuildDone();
+	if (presorted > 0) {
+		/* Filtering keeps the order, so the previously listed vehicles which remain are still at the front. */
+		const VehicleList::const_iterator presorted_end = this->vehicles.cbegin() + presorted;
+		size_t presorted_groups = 0;
+		while (presorted_groups < this->vehgroups.size() && this->vehgroups[presorted_groups].vehicles_begin < presorted_end) {
+			presorted_groups++;
+		}
+		this->vehgroups.RebuildDone(presorted_groups);
+	} else {
+		this->vehgroups.RebuildDone();
+	}
 	this->vscroll->SetCount(static_cast<int>(this->vehgroups.size()));
 }
 
@@ -484,7 +533,21 @@ static btree::btree_map<VehicleID, int> _vehicle_max_speed_loaded;
 
 void BaseVehicleListWindow::SortVehicleList()
 {
-	if (this->vehgroups.Sort()) return;
+	const bool resort = this->vehgroups.WouldSort();
+	const bool altered = this->vehgroups.Sort();
+
+	/* Remember the order after each rebuild or sort, for the next rebuild. */
+	if (this->grouping == GB_NONE && (resort || this->sorted_vehicles.empty())) {
+		this->sorted_vehicles.clear();
+		for (const GUIVehicleGroup &vg : this->vehgroups) {
+			const Vehicle *v = *vg.vehicles_begin;
+			this->sorted_vehicles.push_back({ v->index, v->unitnumber, v->engine_type, v->build_year });
+		}
+		this->sorted_vehicles_type = this->vehgroups.SortType();
+		this->sorted_vehicles_desc = this->vehgroups.IsDescSortOrder();
+	}
+
+	if (altered) return;
 
 	/* invalidate cached values for name sorter - vehicle names could change */
 	_last_vehicle[0] = _last_vehicle[1] = nullptr;
@@ -2056,6 +2119,7 @@ void BaseVehicleListWindow::UpdateSortingFromGrouping()
 	this->vehgroups.SetSortFuncs(this->GetVehicleSorterFuncs());
 	this->vehgroups.SetListing(*this->sorting);
 	this->vehgroups.ForceRebuild();
+	this->vehgroups.ForceResort();
 	this->vehgroups.NeedResort();
 	this->UpdateSortingInterval();
 }
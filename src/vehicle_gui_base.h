@@ -82,6 +82,17 @@ public:
 	uint own_vehicles = 0;                    ///< Count of vehicles of the local company
 	CompanyID own_company;                    ///< Company ID used for own_vehicles
 	GUIVehicleGroupList vehgroups;            ///< List of (groups of) vehicles.  This stores iterators of `vehicles`, and should be rebuilt if `vehicles` is structurally changed.
+
+	/** Identity and sort keys of a listed vehicle, as of the last sort. */
+	struct SortedVehicle {
+		VehicleID index;
+		UnitID unitnumber;
+		EngineID engine_type;
+		Year build_year;
+	};
+	std::vector<SortedVehicle> sorted_vehicles; ///< Vehicles of `vehgroups` in the order of the last sort, when not grouped. It never refers to the vehicles themselves, which may be gone at the next rebuild.
+	uint8 sorted_vehicles_type = UINT8_MAX;     ///< Sort type of `sorted_vehicles`.
+	bool sorted_vehicles_desc = false;          ///< Sort direction of `sorted_vehicles`.
 	Listing *sorting;                         ///< Pointer to the vehicle type related sorting.
 	byte unitnumber_digits;                   ///< The number of digits of the highest unit number.
 	Scrollbar *vscroll;
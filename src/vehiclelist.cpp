@@ -11,6 +11,7 @@
 #include "train.h"
 #include "vehiclelist.h"
 #include "group.h"
+#include "company_base.h"
 #include "tracerestrict.h"
 
 #include "safeguards.h"
@@ -117,6 +118,7 @@ bool GenerateVehicleSortList(VehicleList *list, const VehicleListIdentifier &vli
 	list->clear();
 
 	auto fill_all_vehicles = [&]() {
+		if (Company::IsValidID(vli.company)) list->reserve(GroupStatistics::Get(vli.company, ALL_GROUP, vli.vtype).num_vehicle);
 		for (const Vehicle *v : Vehicle::Iterate()) {
 			if (!HasBit(v->subtype, GVSF_VIRTUAL) && v->type == vli.vtype && v->owner == vli.company && v->IsPrimaryVehicle()) {
 				list->push_back(v);
@@ -152,6 +154,13 @@ bool GenerateVehicleSortList(VehicleList *list, const VehicleListIdentifier &vli
 
 		case VL_GROUP_LIST:
 			if (vli.index != ALL_GROUP) {
+				const Group *g = Group::GetIfValid(vli.index);
+				if (g != nullptr && g->owner == vli.company && g->vehicle_type == vli.vtype) {
+					/* The group statistics tell whether there is anything to find in this group and its sub-groups. */
+					uint count = GetGroupNumVehicle(vli.company, vli.index, vli.vtype);
+					if (count == 0) break;
+					list->reserve(count);
+				}
 				for (const Vehicle *v : Vehicle::Iterate()) {
 					if (!HasBit(v->subtype, GVSF_VIRTUAL) && v->type == vli.vtype && v->IsPrimaryVehicle() &&
 							v->owner == vli.company && GroupIsInGroup(v->group_id, vli.index)) {
@@ -1149,6 +1149,68 @@ Window::~Window()
 	const_cast<volatile WindowClass &>(this->window_class) = WC_INVALID;
 }
 
+/** Valid windows of each class, in back-to-front order. */
+static std::vector<std::vector<Window *>> _window_class_index;
+/** Whether #_window_class_index has to be rebuilt before it can be used. */
+static bool _window_class_index_dirty = true;
+/** Number of active iterations over #_window_class_index, during which it may not be rebuilt. */
+static uint _window_class_index_users = 0;
+
+/** Rebuild the index of windows by class from the z-ordering. */
+static void RebuildWindowClassIndex()
+{
+	for (std::vector<Window *> &windows : _window_class_index) {
+		windows.clear();
+	}
+	for (Window *w : Window::IterateFromBack()) {
+		if (w->window_class >= _window_class_index.size()) _window_class_index.resize(w->window_class + 1);
+		_window_class_index[w->window_class].push_back(w);
+	}
+	_window_class_index_dirty = false;
+}
+
+/**
+ * Call a function for each valid window of a class, in back-to-front order.
+ * Windows which are opened by the function are not visited.
+ * @param cls Window class.
+ * @param func Function to call, returns false to stop the iteration.
+ */
+template <typename F>
+static void IterateWindowsOfClass(WindowClass cls, F func)
+{
+	if (_window_class_index_dirty && _window_class_index_users == 0) RebuildWindowClassIndex();
+
+	if (_window_class_index_dirty) {
+		/* The index is stale but still in use further up the stack, fall back to a full scan. */
+		for (Window *w : Window::IterateFromBack()) {
+			if (w->window_class == cls && !func(w)) return;
+		}
+		return;
+	}
+
+	if (cls >= _window_class_index.size()) return;
+
+	/* The index is not rebuilt while it is in use, and windows are only freed after they have been
+	 * removed from the z-ordering outside of any iteration, so the pointers stay valid. */
+	_window_class_index_users++;
+	const std::vector<Window *> &windows = _window_class_index[cls];
+	for (size_t i = 0; i < windows.size(); i++) {
+		Window *w = windows[i];
+		if (w->window_class == cls && !func(w)) break;
+	}
+	_window_class_index_users--;
+}
+
+/**
+ * Change the class of an open window.
+ * @param cls New window class.
+ */
+void Window::ChangeWindowClass(WindowClass cls)
+{
+	this->window_class = cls;
+	_window_class_index_dirty = true;
+}
+
 /**
  * Find a window by its class and window number
  * @param cls Window class
@@ -1157,11 +1219,13 @@ Window::~Window()
  */
 Window *FindWindowById(WindowClass cls, WindowNumber number)
 {
-	for (Window *w : Window::IterateFromBack()) {
-		if (w->window_class == cls && w->window_number == number) return w;
-	}
-
-	return nullptr;
+	Window *result = nullptr;
+	IterateWindowsOfClass(cls, [&](Window *w) {
+		if (w->window_number != number) return true;
+		result = w;
+		return false;
+	});
+	return result;
 }
 
 /**
@@ -1172,11 +1236,12 @@ Window *FindWindowById(WindowClass cls, WindowNumber number)
  */
 Window *FindWindowByClass(WindowClass cls)
 {
-	for (Window *w : Window::IterateFromBack()) {
-		if (w->window_class == cls) return w;
-	}
-
-	return nullptr;
+	Window *result = nullptr;
+	IterateWindowsOfClass(cls, [&](Window *w) {
+		result = w;
+		return false;
+	});
+	return result;
 }
 
 /**
@@ -1405,6 +1470,8 @@ static void AddWindowToZOrdering(Window *w)
 {
 	assert(w->z_front == nullptr && w->z_back == nullptr);
 
+	_window_class_index_dirty = true;
+
 	if (_z_front_window == nullptr) {
 		/* It's the only window. */
 		_z_front_window = _z_back_window = w;
@@ -1453,6 +1520,8 @@ static void AddWindowToZOrdering(Window *w)
  */
 static void RemoveWindowFromZOrdering(WindowBase *w)
 {
+	_window_class_index_dirty = true;
+
 	if (w->z_front == nullptr) {
 		assert(_z_front_window == w);
 		_z_front_window = w->z_back;
@@ -1928,6 +1997,7 @@ void InitWindowSystem()
 	_z_back_window = nullptr;
 	_z_front_window = nullptr;
 	_first_window = nullptr;
+	_window_class_index_dirty = true;
 	_focused_window = nullptr;
 	_mouseover_last_w = nullptr;
 	_last_scroll_window = nullptr;
@@ -1959,6 +2029,7 @@ void UnInitWindowSystem()
 	_z_front_window = nullptr;
 	_z_back_window = nullptr;
 	_first_window = nullptr;
+	_window_class_index_dirty = true;
 }
 
 /**
@@ -3309,9 +3380,10 @@ void UpdateWindows()
  */
 void SetWindowDirty(WindowClass cls, WindowNumber number)
 {
-	for (Window *w : Window::IterateFromBack()) {
-		if (w->window_class == cls && w->window_number == number) w->SetDirty();
-	}
+	IterateWindowsOfClass(cls, [&](Window *w) {
+		if (w->window_number == number) w->SetDirty();
+		return true;
+	});
 }
 
 /**
@@ -3322,11 +3394,10 @@ void SetWindowDirty(WindowClass cls, WindowNumber number)
  */
 void SetWindowWidgetDirty(WindowClass cls, WindowNumber number, byte widget_index)
 {
-	for (Window *w : Window::IterateFromBack()) {
-		if (w->window_class == cls && w->window_number == number) {
-			w->SetWidgetDirty(widget_index);
-		}
-	}
+	IterateWindowsOfClass(cls, [&](Window *w) {
+		if (w->window_number == number) w->SetWidgetDirty(widget_index);
+		return true;
+	});
 }
 
 /**
@@ -3335,9 +3406,10 @@ void SetWindowWidgetDirty(WindowClass cls, WindowNumber number, byte widget_inde
  */
 void SetWindowClassesDirty(WindowClass cls)
 {
-	for (Window *w : Window::IterateFromBack()) {
-		if (w->window_class == cls) w->SetDirty();
-	}
+	IterateWindowsOfClass(cls, [&](Window *w) {
+		w->SetDirty();
+		return true;
+	});
 }
 
 /**
@@ -3409,11 +3481,10 @@ void Window::ProcessHighlightedInvalidations()
  */
 void InvalidateWindowData(WindowClass cls, WindowNumber number, int data, bool gui_scope)
 {
-	for (Window *w : Window::IterateFromBack()) {
-		if (w->window_class == cls && w->window_number == number) {
-			w->InvalidateData(data, gui_scope);
-		}
-	}
+	IterateWindowsOfClass(cls, [&](Window *w) {
+		if (w->window_number == number) w->InvalidateData(data, gui_scope);
+		return true;
+	});
 }
 
 /**
@@ -3426,11 +3497,10 @@ void InvalidateWindowData(WindowClass cls, WindowNumber number, int data, bool g
  */
 void InvalidateWindowClassesData(WindowClass cls, int data, bool gui_scope)
 {
-	for (Window *w : Window::IterateFromBack()) {
-		if (w->window_class == cls) {
-			w->InvalidateData(data, gui_scope);
-		}
-	}
+	IterateWindowsOfClass(cls, [&](Window *w) {
+		w->InvalidateData(data, gui_scope);
+		return true;
+	});
 }
 
 /**
@@ -580,6 +580,7 @@ public:
 	static int SortButtonWidth();
 
 	void DeleteChildWindows(WindowClass wc = WC_INVALID) const;
+	void ChangeWindowClass(WindowClass cls);
 
 	void SetDirty();
 	void SetDirtyAsBlocks();